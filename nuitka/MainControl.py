@@ -510,6 +510,28 @@ def runScons(main_module, quiet):
     if Options.isProfile():
         options["profile_mode"] = "true"
 
+    if Options.isShowCallSiteStatistics():
+        options["call_site_statistics"] = "true"
+
+    if Options.isShowFrameCacheStatistics():
+        options["frame_cache_statistics"] = "true"
+
+    if Options.isStacklessGenerators():
+        options["stackless_generators"] = "true"
+
+    if Options.getGeneratorStackSize() is not None:
+        options["generator_stack_size"] = str(
+            Options.getGeneratorStackSize()
+        )
+
+    if Options.isAdaptiveGeneratorStacks():
+        options["adaptive_generator_stacks"] = "true"
+
+    if Options.getGeneratorBatchSize() is not None:
+        options["generator_batch_size"] = str(
+            Options.getGeneratorBatchSize()
+        )
+
     return SconsInterface.runScons(options, quiet), options
 
 
@@ -336,6 +336,54 @@ compatibility reasons, the "__file__" value will always have ".py" suffix
 independent of what it really is."""
 )
 
+codegen_group.add_option(
+    "--stackless-generators",
+    action  = "store_true",
+    dest    = "stackless_generators",
+    default = False,
+    help    = """\
+Compile generator bodies as resumable C functions that keep their local
+variables in heap storage, instead of running them on a separate stack each.
+This avoids the stack memory and the context switches of generators. Defaults
+to off."""
+)
+
+codegen_group.add_option(
+    "--generator-stack-size",
+    action  = "store",
+    dest    = "generator_stack_size",
+    metavar = "KIB",
+    default = None,
+    help    = """\
+Stack size in KiB of generators that run on a separate stack. At run time, the
+environment variable "NUITKA_GENERATOR_STACK_SIZE" overrides it. Values below
+64 are raised to that. Defaults to 1024."""
+)
+
+codegen_group.add_option(
+    "--adaptive-generator-stacks",
+    action  = "store_true",
+    dest    = "adaptive_generator_stacks",
+    default = False,
+    help    = """\
+Measure the stack use of the first generators of each code object, and give
+later ones a smaller stack that fits it. Deeper calls in later generators than
+in the measured ones may then overflow the stack. Defaults to off."""
+)
+
+codegen_group.add_option(
+    "--generator-batch-size",
+    action  = "store",
+    dest    = "generator_batch_size",
+    metavar = "COUNT",
+    default = None,
+    help    = """\
+Let generators yield up to this many values ahead without switching back, when
+consumed by a compiled "for" loop. This is only done for generators, that have
+no side effects, cannot raise, and read no state the loop could change. Defaults
+to off."""
+)
+
 codegen_group.add_option(
     "--no-optimization",
     action  = "store_true",
@@ -417,6 +465,27 @@ debug_group.add_option(
 Enable vmprof based profiling of time spent. Defaults to off."""
 )
 
+debug_group.add_option(
+    "--show-call-site-statistics",
+    action  = "store_true",
+    dest    = "call_site_statistics",
+    default = False,
+    help    = """\
+Count hits and misses of the caches that call sites have for the objects they
+call, and output them when the program exits. Call sites that often call other
+kinds of objects are marked as megamorphic. Defaults to off."""
+)
+
+debug_group.add_option(
+    "--show-frame-cache-statistics",
+    action  = "store_true",
+    dest    = "frame_cache_statistics",
+    default = False,
+    help    = """\
+Count hits and misses of the caches that functions have for their frames, and
+output them when the program exits. Defaults to off."""
+)
+
 debug_group.add_option(
     "--graph",
     action  = "store_true",
@@ -703,6 +772,20 @@ if not options.immediate_execution and len(positional_args) > 1:
 Error, need only one positional argument unless "--run" is specified to
 pass them to the compiled program execution.""")
 
+if options.generator_stack_size is not None and \
+   (not options.generator_stack_size.isdigit() or \
+    int(options.generator_stack_size) == 0):
+    sys.exit("""
+Error, '--generator-stack-size' takes a positive number of KiB, not '%s'.""" % \
+options.generator_stack_size)
+
+if options.generator_batch_size is not None and \
+   (not options.generator_batch_size.isdigit() or \
+    int(options.generator_batch_size) < 2):
+    sys.exit("""
+Error, '--generator-batch-size' takes a number of values of at least 2, not '%s'.""" % \
+options.generator_batch_size)
+
 if options.verbose:
     logging.getLogger().setLevel(logging.DEBUG)
 else:
@@ -893,6 +976,30 @@ def isRemoveBuildDir():
 def getIntendedPythonVersion():
     return options.python_version
 
+def isShowCallSiteStatistics():
+    return options.call_site_statistics
+
+def isShowFrameCacheStatistics():
+    return options.frame_cache_statistics
+
+def isStacklessGenerators():
+    return options.stackless_generators
+
+def getGeneratorStackSize():
+    if options.generator_stack_size is None:
+        return None
+
+    return int(options.generator_stack_size)
+
+def isAdaptiveGeneratorStacks():
+    return options.adaptive_generator_stacks
+
+def getGeneratorBatchSize():
+    if options.generator_batch_size is None:
+        return None
+
+    return int(options.generator_batch_size)
+
 def isExperimental():
     return hasattr(options, "experimental") and options.experimental
 
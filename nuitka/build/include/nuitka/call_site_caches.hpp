@@ -0,0 +1,150 @@
+//     Copyright 2016, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+#ifndef __NUITKA_CALL_SITE_CACHES_H__
+#define __NUITKA_CALL_SITE_CACHES_H__
+
+// Decide how to pass positional arguments to a called object. For compiled
+// functions and methods, this depends on their C code, which tells their
+// parameters, and on the number of defaults, which can be changed at run time.
+// For C functions, it depends on their method definition. For all other
+// types, it only depends on the type.
+static inline void *GET_CALL_SITE_KEY( PyObject *called, PyTypeObject *type, Py_ssize_t *version )
+{
+    *version = 0;
+
+    if ( type == &Nuitka_Function_Type )
+    {
+        Nuitka_FunctionObject *function = (Nuitka_FunctionObject *)called;
+
+        *version = function->m_defaults_given;
+        return (void *)function->m_c_code;
+    }
+    else if ( type == &Nuitka_Method_Type )
+    {
+        Nuitka_MethodObject *method = (Nuitka_MethodObject *)called;
+
+        // Unbound methods are called the slow way, make them differ.
+        *version = method->m_object != NULL ? method->m_function->m_defaults_given : -1;
+        return (void *)method->m_function->m_c_code;
+    }
+    else if ( type == &PyCFunction_Type )
+    {
+        return (void *)((PyCFunctionObject *)called)->m_ml;
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+static inline Nuitka_CallStrategy GET_CALL_STRATEGY( PyObject *called, Py_ssize_t args_size )
+{
+    if ( Nuitka_Function_Check( called ) )
+    {
+        Nuitka_FunctionObject *function = (Nuitka_FunctionObject *)called;
+
+        if ( function->m_args_simple && args_size == function->m_args_positional_count )
+        {
+            return NUITKA_CALL_FUNCTION_SIMPLE;
+        }
+        else if ( function->m_args_simple && args_size >= function->m_args_required_count && args_size < function->m_args_positional_count )
+        {
+            return NUITKA_CALL_FUNCTION_DEFAULTS;
+        }
+        else
+        {
+            return NUITKA_CALL_FUNCTION_PARSE;
+        }
+    }
+    else if ( Nuitka_Method_Check( called ) )
+    {
+        Nuitka_MethodObject *method = (Nuitka_MethodObject *)called;
+        Nuitka_FunctionObject *function = method->m_function;
+
+        // Unbound method without arguments, let the error path be slow.
+        if ( method->m_object == NULL )
+        {
+            return NUITKA_CALL_GENERIC;
+        }
+        else if ( function->m_args_simple && args_size + 1 == function->m_args_positional_count )
+        {
+            return NUITKA_CALL_METHOD_SIMPLE;
+        }
+        else if ( function->m_args_simple && args_size + 1 >= function->m_args_required_count && args_size + 1 < function->m_args_positional_count )
+        {
+            return NUITKA_CALL_METHOD_DEFAULTS;
+        }
+        else
+        {
+            return NUITKA_CALL_METHOD_PARSE;
+        }
+    }
+    else if ( PyCFunction_Check( called ) )
+    {
+        int flags = PyCFunction_GET_FLAGS( called );
+
+        if ( flags & METH_NOARGS )
+        {
+            return NUITKA_CALL_CFUNCTION_NOARGS;
+        }
+        else if ( flags & METH_O )
+        {
+            return NUITKA_CALL_CFUNCTION_O;
+        }
+        else
+        {
+            return NUITKA_CALL_CFUNCTION_VARARGS;
+        }
+    }
+    else if ( PyFunction_Check( called ) )
+    {
+        return NUITKA_CALL_PYTHON_FUNCTION;
+    }
+    else
+    {
+        return NUITKA_CALL_GENERIC;
+    }
+}
+
+// Look up the strategy for a called object not in the first cache entry,
+// deciding it and putting it in the cache if not there at all.
+extern Nuitka_CallStrategy UPDATE_CALL_SITE_CACHE( Nuitka_CallSiteCache *cache, PyObject *called, PyTypeObject *type, void *key, Py_ssize_t version, Py_ssize_t args_size );
+
+static inline Nuitka_CallStrategy LOOKUP_CALL_STRATEGY( Nuitka_CallSiteCache *cache, PyObject *called, Py_ssize_t args_size )
+{
+    PyTypeObject *type = Py_TYPE( called );
+
+    Py_ssize_t version;
+    void *key = GET_CALL_SITE_KEY( called, type, &version );
+
+    // Most call sites only ever call one kind of object, check for that
+    // here, and for others out of line.
+    Nuitka_CallSiteCacheEntry *entry = &cache->m_entries[ 0 ];
+
+    if (likely( entry->m_type == type && entry->m_key == key && entry->m_version == version ))
+    {
+#ifdef _NUITKA_CALL_SITE_STATISTICS
+        cache->m_hits += 1;
+#endif
+        return entry->m_strategy;
+    }
+
+    return UPDATE_CALL_SITE_CACHE( cache, called, type, key, version, args_size );
+}
+
+#endif
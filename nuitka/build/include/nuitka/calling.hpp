@@ -18,6 +18,64 @@
 #ifndef __NUITKA_CALLING_H__
 #define __NUITKA_CALLING_H__
 
+// The ways positional arguments are passed to a called object, decided once
+// per kind of called object by the call site caches.
+enum Nuitka_CallStrategy
+{
+    NUITKA_CALL_FUNCTION_SIMPLE,
+    NUITKA_CALL_FUNCTION_DEFAULTS,
+    NUITKA_CALL_FUNCTION_PARSE,
+    NUITKA_CALL_METHOD_SIMPLE,
+    NUITKA_CALL_METHOD_DEFAULTS,
+    NUITKA_CALL_METHOD_PARSE,
+    NUITKA_CALL_CFUNCTION_NOARGS,
+    NUITKA_CALL_CFUNCTION_O,
+    NUITKA_CALL_CFUNCTION_VARARGS,
+    NUITKA_CALL_PYTHON_FUNCTION,
+    NUITKA_CALL_GENERIC
+};
+
+// Number of called object kinds a call site remembers.
+#define NUITKA_CALL_SITE_CACHE_ENTRIES 2
+
+struct Nuitka_CallSiteCacheEntry
+{
+    // Type of the called object, NULL for unused entries.
+    PyTypeObject *m_type;
+
+    // What else decides the strategy for that type, e.g. the C code of
+    // compiled functions and the number of their defaults.
+    void *m_key;
+    Py_ssize_t m_version;
+
+    Nuitka_CallStrategy m_strategy;
+};
+
+// Each call site has one of these, statically allocated. Only the location
+// needs to be initialized.
+struct Nuitka_CallSiteCache
+{
+    char const *m_location;
+
+    Nuitka_CallSiteCacheEntry m_entries[ NUITKA_CALL_SITE_CACHE_ENTRIES ];
+
+#ifdef _NUITKA_CALL_SITE_STATISTICS
+    unsigned long m_hits;
+    unsigned long m_misses;
+
+    Nuitka_CallSiteCache *m_next;
+#endif
+};
+
+// Call sites with constant keyword argument names remember where these go in
+// the parameters of the compiled function code called last.
+struct Nuitka_KeywordIndexes
+{
+    void *m_key;
+
+    Py_ssize_t *m_indexes;
+};
+
 #include "__helpers.hpp"
 
 extern PyObject *const_tuple_empty;
@@ -74,9 +132,25 @@ NUITKA_MAY_BE_UNUSED static PyObject *CALL_FUNCTION( PyObject *function_object,
     }
 }
 
+// Same, but the caller releases the keyword arguments dictionary right after
+// the call, so compiled functions may use it for their star dict parameter.
+extern PyObject *CALL_FUNCTION_GIVING_KWARGS( PyObject *function_object, PyObject *positional_args, PyObject *named_args );
+
 // Function call variant with no arguments provided at all.
 extern PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called );
 
+// Function call variant with positional arguments followed by the values of
+// keyword arguments, the names of which are given as a tuple.
+extern PyObject *CALL_FUNCTION_WITH_KWNAMES( PyObject *called, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes );
+
+// Same, but for a value from "LOOKUP_METHOD", with the object to pass as the
+// first argument, or NULL if it is to be called as it is.
+extern PyObject *CALL_METHOD_WITH_KWNAMES( PyObject *called, PyObject *self, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes );
+
+// Call a C method descriptor from "LOOKUP_METHOD" with its object, without
+// creating a bound C function for it.
+extern PyObject *CALL_METHODDESCR_WITH_ARGS( PyObject *called, PyObject *self, PyObject **args, Py_ssize_t args_size );
+
 // Function call variants with positional arguments tuple.
 NUITKA_MAY_BE_UNUSED static PyObject *CALL_FUNCTION_WITH_POSARGS( PyObject *function_object, PyObject *positional_args )
 {
@@ -26,6 +26,8 @@
 
 #if PYTHON_VERSION >= 350
 
+#include "fibers.hpp"
+
 // The Nuitka_GeneratorObject is the storage associated with a compiled
 // generator object instance of which there can be many for each code.
 typedef struct {
@@ -39,6 +41,10 @@ typedef struct {
     Fiber m_yielder_context;
     Fiber m_caller_context;
 
+    // A compiled coroutine awaited was resumed directly and is done, the body
+    // is to pick up its result from the error set.
+    bool m_yieldfrom_done;
+
     // Weak references are supported for generator objects in CPython.
     PyObject *m_weakrefs;
 
@@ -32,9 +32,10 @@ struct Nuitka_FunctionObject;
 typedef PyObject *(*function_impl_code)( Nuitka_FunctionObject const *, PyObject ** );
 
 // The Nuitka_FunctionObject is the storage associated with a compiled function
-// instance of which there can be many for each code.
+// instance of which there can be many for each code. It is variable sized, with
+// the closure cells stored at the end of it.
 struct Nuitka_FunctionObject {
-    PyObject_HEAD
+    PyObject_VAR_HEAD
 
     PyObject *m_name;
 
@@ -49,6 +50,10 @@ struct Nuitka_FunctionObject {
     Py_ssize_t m_args_star_list_index;
     Py_ssize_t m_args_star_dict_index;
 
+    // The star list parameter may be the argument tuple of the call itself, as
+    // the function only passes it on, and cannot tell it from a copy.
+    bool m_args_star_list_reuse;
+
     // Same as code_object->co_varnames
     PyObject **m_varnames;
 
@@ -61,9 +66,9 @@ struct Nuitka_FunctionObject {
     PyObject *m_defaults;
     Py_ssize_t m_defaults_given;
 
-    // Closure taken objects, for use in __closure__ and for accessing it.
-    PyCellObject **m_closure;
-    Py_ssize_t m_closure_given;
+    // Positional arguments a simple function must be given, the others are
+    // taken from the end of the defaults.
+    Py_ssize_t m_args_required_count;
 
 #if PYTHON_VERSION >= 300
     // List of keyword only defaults, for use in __kwdefaults__ and parameter
@@ -79,6 +84,10 @@ struct Nuitka_FunctionObject {
 #endif
 
     long m_counter;
+
+    // Closure taken objects, for use in __closure__ and for accessing it.
+    Py_ssize_t m_closure_given;
+    PyCellObject *m_closure[1];
 };
 
 extern PyTypeObject Nuitka_Function_Type;
@@ -93,7 +102,8 @@ extern PyObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name,
 extern PyObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc );
 #endif
 
-// Make a function with context.
+// Make a function with context. The references to the closure cells are taken
+// over, the array itself is not.
 #if PYTHON_VERSION < 300
 extern PyObject *Nuitka_Function_New( function_impl_code c_code, PyObject *name, PyCodeObject *code_object, PyObject *defaults, PyObject *module, PyObject *doc, PyCellObject **closure, Py_ssize_t closure_given );
 #elif PYTHON_VERSION < 330
@@ -112,12 +122,66 @@ static inline PyObject *Nuitka_Function_GetName( PyObject *object )
     return ((Nuitka_FunctionObject *)object)->m_name;
 }
 
+// Complete the parameters of a simple function, of which the first "given"
+// ones are set already, with the trailing defaults, and take references to all
+// of them.
+static inline void FILL_DEFAULTED_PARAMETERS( Nuitka_FunctionObject const *function, PyObject **python_pars, Py_ssize_t given )
+{
+    assert( function->m_args_simple );
+    assert( given >= function->m_args_required_count && given <= function->m_args_positional_count );
+
+    INCREASE_REFCOUNTS( python_pars, given );
+
+    for( Py_ssize_t i = given; i < function->m_args_positional_count; i++ )
+    {
+        PyObject *value = PyTuple_GET_ITEM( function->m_defaults, i - function->m_args_required_count );
+
+        python_pars[ i ] = value;
+        Py_INCREF( value );
+    }
+}
+
+// Call the C code of a function known to take exactly the given positional
+// arguments, without any parsing. Like the function object call, this takes
+// new references to the arguments.
+static inline PyObject *CALL_FUNCTION_DIRECT( Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size )
+{
+    assert( function->m_args_simple && args_size == function->m_args_positional_count );
+
+    if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+    {
+        return NULL;
+    }
+
+    for( Py_ssize_t i = 0; i < args_size; i++ )
+    {
+        CHECK_OBJECT( args[ i ] );
+        Py_INCREF( args[ i ] );
+    }
+
+    PyObject *result = function->m_c_code( function, args );
+
+    Py_LeaveRecursiveCall();
+
+    return result;
+}
+
 extern bool parseArgumentsPos( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject **args, Py_ssize_t args_size );
 extern bool parseArgumentsMethodPos( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *object, PyObject **args, Py_ssize_t args_size );
 
 extern PyObject *Nuitka_CallFunctionPosArgsKwArgs( Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw );
 
+// Calls with an argument tuple, which may become the star list parameter. With
+// "kw_given", the caller releases "kw" after the call, so it may become the
+// star dict parameter.
+extern PyObject *Nuitka_CallFunctionTupleArgsKwArgs( Nuitka_FunctionObject const *function, PyObject *tuple_args, PyObject *kw, bool kw_given );
+
 extern PyObject *Nuitka_CallMethodFunctionNoArgs( Nuitka_FunctionObject const *function, PyObject *object );
 extern PyObject *Nuitka_CallMethodFunctionPosArgsKwArgs( Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kw );
 
+// Calls with the keyword argument values following the positional arguments,
+// and their names given as a constant tuple.
+extern PyObject *Nuitka_CallFunctionKwNames( Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes );
+extern PyObject *Nuitka_CallMethodFunctionKwNames( Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes );
+
 #endif
@@ -27,7 +27,12 @@
 // Another cornerstone of the integration into CPython. Try to behave as well as
 // normal generator objects do or even better.
 
+// In stackless mode, generator bodies are resumable functions that return at
+// each yield and continue at its resume label when called again, with their
+// local variables in heap storage. Otherwise they run on a fiber of their own.
+#ifndef _NUITKA_STACKLESS_GENERATORS
 #include "fibers.hpp"
+#endif
 
 // Status of the generator object.
 enum Generator_Status {
@@ -45,12 +50,36 @@ typedef struct {
 
 #if PYTHON_VERSION >= 350
     PyObject *m_qualname;
+#endif
+
+#if PYTHON_VERSION >= 330
+    // The sub-generator currently delegated to with "yield from", if any.
     PyObject *m_yieldfrom;
+
+    // The "yield from" was done in an exception handler.
+    bool m_yieldfrom_in_handler;
+
+    // The value given to "return", raised with StopIteration once finished.
+    PyObject *m_returned;
 #endif
 
+#ifdef _NUITKA_STACKLESS_GENERATORS
+    // The yield point to resume at, zero if not yet started.
+    int m_yield_return_index;
+
+    // Local variables of the generator body, allocated when it starts.
+    void *m_heap_storage;
+#else
     Fiber m_yielder_context;
     Fiber m_caller_context;
 
+#if PYTHON_VERSION >= 330
+    // A compiled sub-generator was resumed directly and is done, the body
+    // is to pick up its result from the error set.
+    bool m_yieldfrom_done;
+#endif
+#endif
+
     // Weak references are supported for generator objects in CPython.
     PyObject *m_weakrefs;
 
@@ -72,6 +101,19 @@ typedef struct {
     // Was it ever used, is it still running, or already finished.
     Generator_Status m_status;
 
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    // Values yielded ahead for a compiled loop, given out from the index on,
+    // and how many more the body may add before switching back.
+    PyObject *m_batch[ _NUITKA_GENERATOR_BATCH_SIZE ];
+    int m_batch_index;
+    int m_batch_count;
+    int m_batch_limit;
+
+    // Exception of the body, to be raised once the values are given out.
+    PyObject *m_batch_exception_type, *m_batch_exception_value;
+    PyTracebackObject *m_batch_exception_tb;
+#endif
+
 } Nuitka_GeneratorObject;
 
 extern PyTypeObject Nuitka_Generator_Type;
@@ -94,6 +136,59 @@ static inline PyObject *Nuitka_Generator_GetName( PyObject *object )
     return ((Nuitka_GeneratorObject *)object)->m_name;
 }
 
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+// For yields, whose value is not used, the generator body may keep going
+// without switching back, while a compiled loop takes values in batches.
+static inline bool YIELD_BATCH( Nuitka_GeneratorObject *generator, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    if ( generator->m_batch_count < generator->m_batch_limit )
+    {
+        generator->m_batch[ generator->m_batch_count++ ] = value;
+        return true;
+    }
+
+    return false;
+}
+
+extern PyObject *Nuitka_Generator_iternext_batched( Nuitka_GeneratorObject *generator );
+
+// Next value for a compiled loop, taken from the values that compiled
+// generators yielded ahead, if any.
+static inline PyObject *ITERATOR_NEXT_BATCHED( PyObject *iterator )
+{
+    if ( Nuitka_Generator_Check( iterator ) )
+    {
+        Nuitka_GeneratorObject *generator = (Nuitka_GeneratorObject *)iterator;
+
+        if ( generator->m_batch_index < generator->m_batch_count )
+        {
+            return generator->m_batch[ generator->m_batch_index++ ];
+        }
+
+        PyObject *result = Nuitka_Generator_iternext_batched( generator );
+
+#if PYTHON_VERSION < 330
+        if ( result == NULL )
+        {
+            PyObject *error = GET_ERROR_OCCURRED();
+
+            if ( error != NULL && EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) )
+            {
+                CLEAR_ERROR_OCCURRED();
+            }
+        }
+#endif
+
+        return result;
+    }
+
+    return ITERATOR_NEXT( iterator );
+}
+#endif
+
+#ifndef _NUITKA_STACKLESS_GENERATORS
 
 static inline PyObject *YIELD( Nuitka_GeneratorObject *generator, PyObject *value )
 {
@@ -217,4 +312,113 @@ extern PyObject *YIELD_FROM( Nuitka_GeneratorObject *generator, PyObject *target
 extern PyObject *YIELD_FROM_IN_HANDLER( Nuitka_GeneratorObject *generator, PyObject *target );
 #endif
 
+#else
+
+// For stackless generators, the generator body gives the value to yield with
+// "YIELD_SUSPEND", returns, and when called again, jumps to the label of the
+// yield return index, where "YIELD_RESUME" gives the sent value.
+
+static inline void YIELD_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *value )
+{
+    CHECK_OBJECT( value );
+
+    generator->m_yielded = value;
+    generator->m_yield_return_index = yield_return_index;
+
+#if PYTHON_VERSION >= 340
+    generator->m_frame->f_executing -= 1;
+#endif
+}
+
+static inline PyObject *_YIELD_RETURN_VALUE( Nuitka_GeneratorObject *generator )
+{
+    // Check for thrown exception.
+    if (unlikely( generator->m_exception_type ))
+    {
+        RESTORE_ERROR_OCCURRED(
+            generator->m_exception_type,
+            generator->m_exception_value,
+            generator->m_exception_tb
+        );
+
+        generator->m_exception_type = NULL;
+        generator->m_exception_value = NULL;
+        generator->m_exception_tb = NULL;
+
+        return NULL;
+    }
+
+    CHECK_OBJECT( generator->m_yielded );
+    return generator->m_yielded;
+}
+
+static inline PyObject *YIELD_RESUME( Nuitka_GeneratorObject *generator )
+{
+#if PYTHON_VERSION >= 340
+    generator->m_frame->f_executing += 1;
+#endif
+
+    return _YIELD_RETURN_VALUE( generator );
+}
+
+#if PYTHON_VERSION >= 300
+// When yielding from an exception handler in Python3, the exception preserved
+// to the frame is restored, while the current one is put there. When resuming,
+// the same exchange is done to undo it.
+static inline void SWAP_GENERATOR_EXCEPTION( void )
+{
+    PyThreadState *thread_state = PyThreadState_GET();
+
+    PyObject *saved_exception_type = thread_state->exc_type;
+    PyObject *saved_exception_value = thread_state->exc_value;
+    PyObject *saved_exception_traceback = thread_state->exc_traceback;
+
+    thread_state->exc_type = thread_state->frame->f_exc_type;
+    thread_state->exc_value = thread_state->frame->f_exc_value;
+    thread_state->exc_traceback = thread_state->frame->f_exc_traceback;
+
+    thread_state->frame->f_exc_type = saved_exception_type;
+    thread_state->frame->f_exc_value = saved_exception_value;
+    thread_state->frame->f_exc_traceback = saved_exception_traceback;
+}
+
+static inline void YIELD_IN_HANDLER_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *value )
+{
+    SWAP_GENERATOR_EXCEPTION();
+
+    YIELD_SUSPEND( generator, yield_return_index, value );
+}
+
+static inline PyObject *YIELD_IN_HANDLER_RESUME( Nuitka_GeneratorObject *generator )
+{
+#if PYTHON_VERSION >= 340
+    generator->m_frame->f_executing += 1;
+#endif
+
+    SWAP_GENERATOR_EXCEPTION();
+
+    return _YIELD_RETURN_VALUE( generator );
+}
+#endif
+
+#if PYTHON_VERSION >= 330
+// For "yield from", the sub-generator is driven by the generator object itself
+// while the generator body is suspended. The body is only resumed when the
+// sub-generator is exhausted, which may also happen immediately, and then the
+// result is given by "YIELD_FROM_RESUME" as a new reference.
+extern bool YIELD_FROM_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *target );
+extern bool YIELD_FROM_IN_HANDLER_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *target );
+
+static inline PyObject *YIELD_FROM_RESUME( Nuitka_GeneratorObject *generator )
+{
+#if PYTHON_VERSION >= 340
+    generator->m_frame->f_executing += 1;
+#endif
+
+    return _YIELD_RETURN_VALUE( generator );
+}
+#endif
+
+#endif
+
 #endif
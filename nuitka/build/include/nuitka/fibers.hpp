@@ -38,9 +38,35 @@ typedef struct _Fiber
 #else
     ucontext_t f_context;
     void *start_stack;
+    size_t stack_size;
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+    // The code object the stack size is adapted to, and if the stack use is
+    // to be measured for it.
+    void *stack_key;
+    bool stack_measured;
+#endif
 #endif
 } Fiber;
 
+#if defined( _WIN32 ) || defined( __OpenBSD__ )
+#undef _NUITKA_ADAPTIVE_FIBER_STACKS
+#else
+// Stacks for the ucontext based fibers, mapped with a guard page and pooled
+// per thread, with "start_stack" and "stack_size" set.
+extern bool acquireFiberStack( Fiber *to );
+extern void releaseFiberStack( Fiber *to );
+#endif
+
+// Tell what code object will run on the fiber, for adaptive stack sizes.
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+static inline void setFiberStackKey( Fiber *to, void *key )
+{
+    to->stack_key = key;
+}
+#else
+#define setFiberStackKey( to, key )
+#endif
+
 extern "C" void _initFiber( Fiber *to );
 extern "C" void _swapFiber( Fiber *to, Fiber *from );
 extern "C" int _prepareFiber( Fiber *to, void *code, uintptr_t arg );
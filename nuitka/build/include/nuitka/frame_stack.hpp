@@ -18,12 +18,28 @@
 #ifndef __NUITKA_FRAME_STACK_H__
 #define __NUITKA_FRAME_STACK_H__
 
-#define MAKE_OR_REUSE_FRAME( cache_identifier, code_identifier, module_identifier )    \
-    if ( isFrameUnusable( cache_identifier ) )                                         \
-    {                                                                                  \
-        Py_XDECREF( cache_identifier );                                                \
-        cache_identifier = MAKE_FUNCTION_FRAME( code_identifier, module_identifier );  \
-    }                                                                                  \
+// The maximum number of frames kept for reuse per code object, can be
+// overridden at compile time, e.g. via CPPFLAGS.
+#ifndef _NUITKA_FRAME_CACHE_DEPTH
+#define _NUITKA_FRAME_CACHE_DEPTH 8
+#endif
+
+// Each function with a frame has one of these, statically allocated. Frames
+// are indexed by depth of recursion, as outer activations of a function keep
+// using theirs. Threads running the function at the same time are in it too,
+// so they each use their own frames.
+struct Nuitka_FrameCache
+{
+    PyFrameObject *m_frames[ _NUITKA_FRAME_CACHE_DEPTH ];
+
+#ifdef _NUITKA_FRAME_CACHE_STATISTICS
+    unsigned long m_hits;
+    unsigned long m_misses;
+
+    PyCodeObject *m_code;
+    Nuitka_FrameCache *m_next;
+#endif
+};
 
 inline static void assertCodeObject( PyCodeObject *code_object )
 {
@@ -53,10 +69,6 @@ NUITKA_MAY_BE_UNUSED static bool isFrameUnusable( PyFrameObject *frame_object )
         frame_object == NULL ||
         // Still in use
         Py_REFCNT( frame_object ) > 1 ||
-#if PYTHON_VERSION < 340
-        // Last used by another thread (TODO: Could just set it when re-using)
-        frame_object->f_tstate != PyThreadState_GET() ||
-#endif
         // Was detached from (TODO: When detaching, can't we just have another
         // frame guard instead)
         frame_object->f_back != NULL;
@@ -75,6 +87,30 @@ NUITKA_MAY_BE_UNUSED static bool isFrameUnusable( PyFrameObject *frame_object )
     return result;
 }
 
+// Find a usable frame at a deeper level of the cache, making it if necessary.
+extern PyFrameObject *UPDATE_FRAME_CACHE( Nuitka_FrameCache *cache, PyCodeObject *code, PyObject *module );
+
+NUITKA_MAY_BE_UNUSED static PyFrameObject *MAKE_OR_REUSE_FRAME( Nuitka_FrameCache *cache, PyCodeObject *code, PyObject *module )
+{
+    PyFrameObject *frame_object = cache->m_frames[ 0 ];
+
+    // Functions that do not recurse use only the first frame, check for that
+    // here, and for others out of line.
+    if (likely( frame_object != NULL && !isFrameUnusable( frame_object ) ))
+    {
+#if PYTHON_VERSION < 340
+        // Might have been last used by another thread.
+        frame_object->f_tstate = PyThreadState_GET();
+#endif
+#ifdef _NUITKA_FRAME_CACHE_STATISTICS
+        cache->m_hits += 1;
+#endif
+        return frame_object;
+    }
+
+    return UPDATE_FRAME_CACHE( cache, code, module );
+}
+
 NUITKA_MAY_BE_UNUSED inline static void popFrameStack( void )
 {
     PyThreadState *tstate = PyThreadState_GET();
@@ -104,6 +140,12 @@ NUITKA_MAY_BE_UNUSED inline static void popFrameStack( void )
 #endif
 }
 
+// Frames are pushed when a function starts, and not only when something
+// looks at them. CPython code reads "tstate->frame" directly, e.g. in
+// "sys._getframe", in warnings, and for the tracebacks of C code, and any
+// operation that may raise may also run Python code below us. The frame
+// object itself is made only once per function and depth, see the frame cache,
+// so pushing it is only linking it.
 NUITKA_MAY_BE_UNUSED inline static void pushFrameStack( PyFrameObject *frame_object )
 {
     assertFrameObject( frame_object );
@@ -175,4 +217,8 @@ static inline void dumpFrameStack( void )
 // enough so that the line numbers are detached.
 extern void detachFrame( PyTracebackObject *traceback, PyObject *locals );
 
+// Put the previous frame back on top, as an exception leaves a function, giving
+// its frame to the traceback without a copy where possible.
+extern void popDetachedFrame( Nuitka_FrameCache *cache, PyTracebackObject *traceback, PyObject *locals );
+
 #endif
@@ -174,6 +174,12 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE( PyObject *source, PyObje
     }
 }
 
+// Look up an attribute to call it. For functions and C method descriptors found
+// in the type, these are returned with the object to pass as their first
+// argument in "self", so no bound method needs to be created. Otherwise "self"
+// is set to NULL and the attribute value is returned.
+extern PyObject *LOOKUP_METHOD( PyObject *source, PyObject *attr_name, PyObject **self );
+
 NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_ATTRIBUTE_DICT_SLOT( PyObject *source )
 {
     CHECK_OBJECT( source );
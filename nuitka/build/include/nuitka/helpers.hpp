@@ -58,6 +58,17 @@ NUITKA_MAY_BE_UNUSED static PyObject *INCREASE_REFCOUNT( PyObject *object )
     return object;
 }
 
+// Take references to all objects of an array, e.g. for parameters.
+NUITKA_MAY_BE_UNUSED static inline void INCREASE_REFCOUNTS( PyObject **objects, Py_ssize_t count )
+{
+    for( Py_ssize_t i = 0; i < count; i++ )
+    {
+        CHECK_OBJECT( objects[ i ] );
+
+        Py_INCREF( objects[ i ] );
+    }
+}
+
 NUITKA_MAY_BE_UNUSED static PyObject *DECREASE_REFCOUNT( PyObject *object )
 {
     CHECK_OBJECT( object );
@@ -660,6 +671,17 @@ extern void patchTypeComparison( void );
 extern void _initSlotCompare( void );
 #endif
 
+// The type of C method descriptors, e.g. "list.append", which Python2 does not
+// export, so it is taken from one at start up.
+#if PYTHON_VERSION < 300
+extern PyTypeObject *Nuitka_MethodDescr_Type;
+extern void _initMethodDescrType( void );
+#else
+#define Nuitka_MethodDescr_Type (&PyMethodDescr_Type)
+#endif
+
+#define Nuitka_MethodDescr_Check( object ) ( Py_TYPE( object ) == Nuitka_MethodDescr_Type )
+
 #if PYTHON_VERSION >= 300
 NUITKA_MAY_BE_UNUSED static PyObject *SELECT_METACLASS( PyObject *metaclass, PyObject *bases )
 {
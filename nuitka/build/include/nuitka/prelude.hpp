@@ -217,6 +217,8 @@ extern PyObject *_sentinel_value;
 
 #include "nuitka/compiled_method.hpp"
 
+#include "nuitka/call_site_caches.hpp"
+
 #include "nuitka/compiled_frame.hpp"
 
 #if PYTHON_VERSION >= 350
@@ -2305,49 +2305,146 @@ void _initBuiltinModule()
 }
 
 
-PyObject *callPythonFunction( PyObject *func, PyObject **args, int count )
+// Flags of code objects, for which frames cannot be set up by only binding
+// the arguments, as star parameters or generators are involved.
+#if PYTHON_VERSION < 350
+#define CO_NOT_DIRECT ( CO_VARARGS | CO_VARKEYWORDS | CO_GENERATOR )
+#else
+#define CO_NOT_DIRECT ( CO_VARARGS | CO_VARKEYWORDS | CO_GENERATOR | CO_COROUTINE | CO_ITERABLE_COROUTINE )
+#endif
+
+// Run an uncompiled function in a frame set up directly, binding positional
+// arguments, keyword arguments named in "kwnames" following them, defaults,
+// and the closure. This is only done for plain functions without cell
+// variables, and when all arguments are fine, otherwise false is returned,
+// and the generic way, which also gives the errors, is to be used.
+static bool callPythonFunctionFrame( PyObject *func, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, PyObject **result )
 {
     PyCodeObject *co = (PyCodeObject *)PyFunction_GET_CODE( func );
-    PyObject *globals = PyFunction_GET_GLOBALS( func );
-    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
+
+    if ( ( co->co_flags & ( CO_OPTIMIZED | CO_NEWLOCALS ) ) != ( CO_OPTIMIZED | CO_NEWLOCALS ) ||
+         ( co->co_flags & CO_NOT_DIRECT ) != 0 ||
+         PyTuple_GET_SIZE( co->co_cellvars ) != 0 )
+    {
+        return false;
+    }
 
 #if PYTHON_VERSION >= 300
-    PyObject *kwdefs = PyFunction_GET_KW_DEFAULTS( func );
+    if ( co->co_kwonlyargcount != 0 )
+    {
+        return false;
+    }
+#endif
+
+    Py_ssize_t arg_count = co->co_argcount;
+
+    if ( args_size > arg_count )
+    {
+        return false;
+    }
 
-    if ( kwdefs == NULL && argdefs == NULL && co->co_argcount == count &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
+#ifdef _MSC_VER
+    PyObject **values = (PyObject **)_alloca( sizeof( PyObject * ) * ( arg_count + 1 ) );
 #else
-    if ( argdefs == NULL && co->co_argcount == count &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
+    PyObject *values[ arg_count + 1 ];
 #endif
+
+    memcpy( values, args, args_size * sizeof( PyObject * ) );
+
+    for( Py_ssize_t i = args_size; i < arg_count; i++ )
     {
-        PyThreadState *tstate = PyThreadState_GET();
-        CHECK_OBJECT( globals );
+        values[ i ] = NULL;
+    }
 
-        PyFrameObject *frame = PyFrame_New( tstate, co, globals, NULL );
+    // Keyword argument names and parameter names are normally both interned,
+    // other matches are left to the generic way.
+    if ( kwnames != NULL )
+    {
+        Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
 
-        if (unlikely( frame == NULL ))
+        for( Py_ssize_t i = 0; i < kw_size; i++ )
         {
-            return NULL;
-        };
+            PyObject *kw_name = PyTuple_GET_ITEM( kwnames, i );
+
+            Py_ssize_t j = args_size;
+
+            while ( j < arg_count && PyTuple_GET_ITEM( co->co_varnames, j ) != kw_name )
+            {
+                j += 1;
+            }
+
+            if ( j == arg_count || values[ j ] != NULL )
+            {
+                return false;
+            }
+
+            values[ j ] = args[ args_size + i ];
+        }
+    }
+
+    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
+    Py_ssize_t defaults_count = argdefs != NULL ? PyTuple_GET_SIZE( argdefs ) : 0;
 
-        for ( int i = 0; i < count; i++ )
+    for( Py_ssize_t i = args_size; i < arg_count; i++ )
+    {
+        if ( values[ i ] == NULL )
         {
-            frame->f_localsplus[i] = args[i];
-            Py_INCREF( frame->f_localsplus[i] );
+            Py_ssize_t default_index = i - ( arg_count - defaults_count );
+
+            if ( default_index < 0 )
+            {
+                return false;
+            }
+
+            values[ i ] = PyTuple_GET_ITEM( argdefs, default_index );
         }
+    }
 
-        PyObject *result = PyEval_EvalFrameEx( frame, 0 );
+    PyThreadState *tstate = PyThreadState_GET();
+    PyObject *globals = PyFunction_GET_GLOBALS( func );
+    CHECK_OBJECT( globals );
 
-        // Frame release protects against recursion as it may lead to variable
-        // destruction.
-        ++tstate->recursion_depth;
-        Py_DECREF( frame );
-        --tstate->recursion_depth;
+    PyFrameObject *frame = PyFrame_New( tstate, co, globals, NULL );
 
-        return result;
+    if (unlikely( frame == NULL ))
+    {
+        *result = NULL;
+        return true;
+    }
+
+    for( Py_ssize_t i = 0; i < arg_count; i++ )
+    {
+        frame->f_localsplus[ i ] = INCREASE_REFCOUNT( values[ i ] );
+    }
+
+    // Without cell variables, the free variables follow the locals.
+    PyObject *closure = PyFunction_GET_CLOSURE( func );
+
+    if ( closure != NULL )
+    {
+        for( Py_ssize_t i = 0; i < PyTuple_GET_SIZE( closure ); i++ )
+        {
+            frame->f_localsplus[ co->co_nlocals + i ] = INCREASE_REFCOUNT( PyTuple_GET_ITEM( closure, i ) );
+        }
     }
 
+    *result = PyEval_EvalFrameEx( frame, 0 );
+
+    // Frame release protects against recursion as it may lead to variable
+    // destruction.
+    ++tstate->recursion_depth;
+    Py_DECREF( frame );
+    --tstate->recursion_depth;
+
+    return true;
+}
+
+// Run an uncompiled function the generic way, with the keyword arguments as
+// pairs of names and values.
+static PyObject *callPythonFunctionEval( PyObject *func, PyObject **args, Py_ssize_t args_size, PyObject **kws, Py_ssize_t kw_size )
+{
+    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
+
     PyObject **defaults = NULL;
     int nd = 0;
 
@@ -2359,20 +2456,20 @@ PyObject *callPythonFunction( PyObject *func, PyObject **args, int count )
 
     PyObject *result = PyEval_EvalCodeEx(
 #if PYTHON_VERSION >= 300
-        (PyObject *)co,
+        PyFunction_GET_CODE( func ),
 #else
-        co,        // code object
+        (PyCodeObject *)PyFunction_GET_CODE( func ),
 #endif
-        globals,   // globals
-        NULL,      // no locals
-        args,      // args
-        count,     // argcount
-        NULL,      // kwds
-        0,         // kwcount
-        defaults,  // defaults
-        nd,        // defcount
+        PyFunction_GET_GLOBALS( func ),
+        NULL,            // no locals
+        args,            // args
+        int( args_size ),
+        kws,             // kwds
+        int( kw_size ),  // kwcount
+        defaults,        // defaults
+        nd,              // defcount
 #if PYTHON_VERSION >= 300
-        kwdefs,
+        PyFunction_GET_KW_DEFAULTS( func ),
 #endif
         PyFunction_GET_CLOSURE( func )
     );
@@ -2380,73 +2477,135 @@ PyObject *callPythonFunction( PyObject *func, PyObject **args, int count )
     return result;
 }
 
+PyObject *callPythonFunction( PyObject *func, PyObject **args, int count )
+{
+    PyObject *result;
+
+    if ( callPythonFunctionFrame( func, args, count, NULL, &result ) )
+    {
+        return result;
+    }
+
+    return callPythonFunctionEval( func, args, count, NULL, 0 );
+}
+
 static PyObject *_fast_function_noargs( PyObject *func )
 {
-    PyCodeObject *co = (PyCodeObject *)PyFunction_GET_CODE( func );
-    PyObject *globals = PyFunction_GET_GLOBALS( func );
-    PyObject *argdefs = PyFunction_GET_DEFAULTS( func );
+    return callPythonFunction( func, NULL, 0 );
+}
 
-#if PYTHON_VERSION >= 300
-    PyObject *kwdefs = PyFunction_GET_KW_DEFAULTS( func );
+// Call an uncompiled function with positional arguments followed by the values
+// of keyword arguments, the names of which are given as a tuple.
+static PyObject *callPythonFunctionKwNames( PyObject *func, PyObject **args, Py_ssize_t args_size, PyObject *kwnames )
+{
+    PyObject *result;
+
+    if ( callPythonFunctionFrame( func, args, args_size, kwnames, &result ) )
+    {
+        return result;
+    }
+
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
 
-    if ( kwdefs == NULL && argdefs == NULL && co->co_argcount == 0 &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
+#ifdef _MSC_VER
+    PyObject **kws = (PyObject **)_alloca( sizeof( PyObject * ) * 2 * kw_size );
 #else
-    if ( argdefs == NULL && co->co_argcount == 0 &&
-        co->co_flags == ( CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE ))
+    PyObject *kws[ 2 * kw_size ];
 #endif
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
     {
-        PyThreadState *tstate = PyThreadState_GET();
-        CHECK_OBJECT( globals );
+        kws[ 2 * i ] = PyTuple_GET_ITEM( kwnames, i );
+        kws[ 2 * i + 1 ] = args[ args_size + i ];
+    }
 
-        PyFrameObject *frame = PyFrame_New( tstate, co, globals, NULL );
+    return callPythonFunctionEval( func, args, args_size, kws, kw_size );
+}
 
-        if (unlikely( frame == NULL ))
-        {
-            return NULL;
-        };
+// Call the C code of a method definition directly, for the conventions that
+// need no argument tuple, or the empty one. For others, and for the wrong number
+// of arguments, it returns false, and the generic call is to be used, which also
+// gives the errors.
+static bool callMethodDef( PyMethodDef *method_def, PyObject *self, PyObject **args, Py_ssize_t args_size, PyObject **result )
+{
+    int flags = method_def->ml_flags & ~(METH_CLASS | METH_STATIC | METH_COEXIST);
 
-        PyObject *result = PyEval_EvalFrameEx( frame, 0 );
+    if ( flags == METH_NOARGS && args_size == 0 )
+    {
+        *result = (*method_def->ml_meth)( self, NULL );
+    }
+    else if ( flags == METH_O && args_size == 1 )
+    {
+        *result = (*method_def->ml_meth)( self, args[0] );
+    }
+    else if ( flags == METH_VARARGS || flags == ( METH_VARARGS | METH_KEYWORDS ) )
+    {
+        PyObject *pos_args = args_size == 0 ? INCREASE_REFCOUNT( const_tuple_empty ) : MAKE_TUPLE( args, args_size );
 
-        // Frame release protects against recursion as it may lead to variable
-        // destruction.
-        ++tstate->recursion_depth;
-        Py_DECREF( frame );
-        --tstate->recursion_depth;
+        if ( flags & METH_KEYWORDS )
+        {
+            *result = (*(PyCFunctionWithKeywords)method_def->ml_meth)( self, pos_args, NULL );
+        }
+        else
+        {
+            *result = (*method_def->ml_meth)( self, pos_args );
+        }
 
-        return result;
+        Py_DECREF( pos_args );
+    }
+    else
+    {
+        return false;
     }
 
-    PyObject **defaults = NULL;
-    int nd = 0;
-
-    if ( argdefs != NULL )
+    if ( *result == NULL )
     {
-        defaults = &PyTuple_GET_ITEM( argdefs, 0 );
-        nd = int( Py_SIZE( argdefs ) );
+        // Buggy C functions may return NULL without an error set, which is
+        // not allowed.
+        if (unlikely( !ERROR_OCCURRED() ))
+        {
+            PyErr_Format(
+                PyExc_SystemError,
+                "NULL result without error in PyObject_Call"
+            );
+        }
+    }
+    else
+    {
+        // Other buggy C functions set an error, but do not indicate it, and
+        // Nuitka inner workings can get upset from it.
+        DROP_ERROR_OCCURRED();
     }
 
-    PyObject *result = PyEval_EvalCodeEx(
-#if PYTHON_VERSION >= 300
-        (PyObject *)co,
-#else
-        co,        // code object
-#endif
-        globals,   // globals
-        NULL,      // no locals
-        NULL,      // args
-        0,         // argcount
-        NULL,      // kwds
-        0,         // kwcount
-        defaults,  // defaults
-        nd,        // defcount
-#if PYTHON_VERSION >= 300
-        kwdefs,
-#endif
-        PyFunction_GET_CLOSURE( func )
-    );
+    return true;
+}
 
-    return result;
+PyObject *CALL_FUNCTION_GIVING_KWARGS( PyObject *called, PyObject *positional_args, PyObject *named_args )
+{
+    CHECK_OBJECT( called );
+    CHECK_OBJECT( positional_args );
+    CHECK_OBJECT( named_args );
+
+    if ( Nuitka_Function_Check( called ) )
+    {
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
+
+        PyObject *result = Nuitka_CallFunctionTupleArgsKwArgs(
+            (Nuitka_FunctionObject *)called,
+            positional_args,
+            named_args,
+            true
+        );
+
+        Py_LeaveRecursiveCall();
+
+        return result;
+    }
+
+    return CALL_FUNCTION( called, positional_args, named_args );
 }
 
 PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
@@ -2468,14 +2627,13 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
         {
             result = function->m_c_code( function, NULL );
         }
-        else if ( function->m_args_simple && function->m_defaults_given == function->m_args_positional_count )
+        else if ( function->m_args_simple && function->m_args_required_count == 0 )
         {
+            // All parameters are from the defaults, which can be passed as
+            // they are.
             PyObject **python_pars = &PyTuple_GET_ITEM( function->m_defaults, 0 );
 
-            for( Py_ssize_t i = 0; i < function->m_defaults_given; i++ )
-            {
-                Py_INCREF( python_pars[ i ] );
-            }
+            INCREASE_REFCOUNTS( python_pars, function->m_defaults_given );
 
             result = function->m_c_code( function, python_pars );
         }
@@ -2523,7 +2681,7 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
 
                 result = function->m_c_code( function, &method->m_object );
             }
-            else if ( function->m_args_simple && function->m_defaults_given == function->m_args_positional_count - 1 )
+            else if ( function->m_args_simple && function->m_args_required_count <= 1 && function->m_args_positional_count > 1 )
             {
 #ifdef _MSC_VER
                 PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
@@ -2531,12 +2689,8 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
                 PyObject *python_pars[ function->m_args_overall_count ];
 #endif
                 python_pars[0] = method->m_object;
-                memcpy( python_pars+1, &PyTuple_GET_ITEM( function->m_defaults, 0 ), sizeof(PyObject *) * function->m_defaults_given );
 
-                for( Py_ssize_t i = 0; i < function->m_args_positional_count; i++ )
-                {
-                    Py_INCREF( python_pars[ i ] );
-                }
+                FILL_DEFAULTED_PARAMETERS( function, python_pars, 1 );
 
                 result = function->m_c_code( function, python_pars );
             }
@@ -2550,6 +2704,15 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
             return result;
         }
     }
+    else if ( PyCFunction_Check( called ) )
+    {
+        PyObject *result;
+
+        if ( callMethodDef( ((PyCFunctionObject *)called)->m_ml, PyCFunction_GET_SELF( called ), NULL, 0, &result ) )
+        {
+            return result;
+        }
+    }
     else if ( PyFunction_Check( called ) )
     {
         return _fast_function_noargs( called );
@@ -2562,6 +2725,349 @@ PyObject *CALL_FUNCTION_NO_ARGS( PyObject *called )
     );
 }
 
+PyObject *CALL_FUNCTION_WITH_KWNAMES( PyObject *called, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes )
+{
+    CHECK_OBJECT( called );
+
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
+
+    // Check if arguments are valid objects in debug mode.
+#ifndef __NUITKA_NO_ASSERT__
+    for( Py_ssize_t i = 0; i < args_size + kw_size; i++ )
+    {
+        CHECK_OBJECT( args[ i ] );
+    }
+#endif
+
+    if ( Nuitka_Function_Check( called ) )
+    {
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
+
+        PyObject *result = Nuitka_CallFunctionKwNames(
+            (Nuitka_FunctionObject *)called,
+            args,
+            args_size,
+            kwnames,
+            indexes
+        );
+
+        Py_LeaveRecursiveCall();
+
+        return result;
+    }
+    else if ( Nuitka_Method_Check( called ) && ((Nuitka_MethodObject *)called)->m_object != NULL )
+    {
+        Nuitka_MethodObject *method = (Nuitka_MethodObject *)called;
+
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
+
+        PyObject *result = Nuitka_CallMethodFunctionKwNames(
+            method->m_function,
+            method->m_object,
+            args,
+            args_size,
+            kwnames,
+            indexes
+        );
+
+        Py_LeaveRecursiveCall();
+
+        return result;
+    }
+    else if ( PyFunction_Check( called ) )
+    {
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
+
+        PyObject *result = callPythonFunctionKwNames( called, args, args_size, kwnames );
+
+        Py_LeaveRecursiveCall();
+
+        return result;
+    }
+
+    PyObject *pos_args = MAKE_TUPLE( args, args_size );
+    PyObject *named_args = _PyDict_NewPresized( kw_size );
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        PyDict_SetItem( named_args, PyTuple_GET_ITEM( kwnames, i ), args[ args_size + i ] );
+    }
+
+    PyObject *result = CALL_FUNCTION(
+        called,
+        pos_args,
+        named_args
+    );
+
+    Py_DECREF( pos_args );
+    Py_DECREF( named_args );
+
+    return result;
+}
+
+PyObject *LOOKUP_METHOD( PyObject *source, PyObject *attr_name, PyObject **self )
+{
+    CHECK_OBJECT( source );
+    CHECK_OBJECT( attr_name );
+
+    *self = NULL;
+
+#if PYTHON_VERSION < 300
+    if ( PyInstance_Check( source ) )
+    {
+        PyInstanceObject *source_instance = (PyInstanceObject *)source;
+
+        // Values from the instance dictionary are called as they are.
+        if ( GET_STRING_DICT_VALUE( (PyDictObject *)source_instance->in_dict, (PyStringObject *)attr_name ) == NULL )
+        {
+            PyObject *called = FIND_ATTRIBUTE_IN_CLASS( source_instance->in_class, attr_name );
+
+            if ( called != NULL && ( Nuitka_Function_Check( called ) || PyFunction_Check( called ) ) )
+            {
+                *self = source;
+                return INCREASE_REFCOUNT( called );
+            }
+        }
+    }
+    else
+#endif
+    {
+        PyTypeObject *type = Py_TYPE( source );
+
+        if ( type->tp_getattro == PyObject_GenericGetAttr && type->tp_dict != NULL )
+        {
+            PyObject *called = _PyType_Lookup( type, attr_name );
+
+            // Functions are not data descriptors, values from the instance
+            // dictionary take precedence.
+            if ( called != NULL && ( Nuitka_Function_Check( called ) || PyFunction_Check( called ) || Nuitka_MethodDescr_Check( called ) ) )
+            {
+                // The dictionary lookup may run code that changes the type, so
+                // keep the borrowed value alive, like "PyObject_GenericGetAttr"
+                // does.
+                Py_INCREF( called );
+
+                PyObject **dict_ptr = _PyObject_GetDictPtr( source );
+
+                if ( dict_ptr == NULL || *dict_ptr == NULL || PyDict_GetItem( *dict_ptr, attr_name ) == NULL )
+                {
+                    *self = source;
+                    return called;
+                }
+
+                Py_DECREF( called );
+            }
+        }
+    }
+
+    return LOOKUP_ATTRIBUTE( source, attr_name );
+}
+
+PyObject *CALL_METHOD_WITH_KWNAMES( PyObject *called, PyObject *self, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes )
+{
+    if ( self == NULL )
+    {
+        return CALL_FUNCTION_WITH_KWNAMES( called, args, args_size, kwnames, indexes );
+    }
+
+    CHECK_OBJECT( called );
+    CHECK_OBJECT( self );
+
+    if ( Nuitka_Function_Check( called ) )
+    {
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
+
+        PyObject *result = Nuitka_CallMethodFunctionKwNames(
+            (Nuitka_FunctionObject *)called,
+            self,
+            args,
+            args_size,
+            kwnames,
+            indexes
+        );
+
+        Py_LeaveRecursiveCall();
+
+        return result;
+    }
+
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
+
+    if ( PyFunction_Check( called ) )
+    {
+#ifdef _MSC_VER
+        PyObject **method_args = (PyObject **)_alloca( sizeof( PyObject * ) * ( args_size + 1 + kw_size ) );
+#else
+        PyObject *method_args[ args_size + 1 + kw_size ];
+#endif
+        method_args[ 0 ] = self;
+        memcpy( method_args + 1, args, ( args_size + kw_size ) * sizeof( PyObject * ) );
+
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
+
+        PyObject *result = callPythonFunctionKwNames( called, method_args, args_size + 1, kwnames );
+
+        Py_LeaveRecursiveCall();
+
+        return result;
+    }
+
+    // C methods take keyword arguments as a dictionary only.
+    assert( Nuitka_MethodDescr_Check( called ) );
+
+    PyObject *pos_args = PyTuple_New( args_size + 1 );
+
+    PyTuple_SET_ITEM( pos_args, 0, INCREASE_REFCOUNT( self ) );
+
+    for( Py_ssize_t i = 0; i < args_size; i++ )
+    {
+        PyTuple_SET_ITEM( pos_args, i + 1, INCREASE_REFCOUNT( args[ i ] ) );
+    }
+
+    PyObject *named_args = _PyDict_NewPresized( kw_size );
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        PyDict_SetItem( named_args, PyTuple_GET_ITEM( kwnames, i ), args[ args_size + i ] );
+    }
+
+    PyObject *result = CALL_FUNCTION(
+        called,
+        pos_args,
+        named_args
+    );
+
+    Py_DECREF( pos_args );
+    Py_DECREF( named_args );
+
+    return result;
+}
+
+PyObject *CALL_METHODDESCR_WITH_ARGS( PyObject *called, PyObject *self, PyObject **args, Py_ssize_t args_size )
+{
+    CHECK_OBJECT( called );
+    CHECK_OBJECT( self );
+
+    assert( Nuitka_MethodDescr_Check( called ) );
+
+    PyObject *result;
+
+    if ( callMethodDef( ((PyMethodDescrObject *)called)->d_method, self, args, args_size, &result ) )
+    {
+        return result;
+    }
+
+    PyObject *pos_args = PyTuple_New( args_size + 1 );
+
+    PyTuple_SET_ITEM( pos_args, 0, INCREASE_REFCOUNT( self ) );
+
+    for( Py_ssize_t i = 0; i < args_size; i++ )
+    {
+        PyTuple_SET_ITEM( pos_args, i + 1, INCREASE_REFCOUNT( args[ i ] ) );
+    }
+
+    result = CALL_FUNCTION(
+        called,
+        pos_args,
+        NULL
+    );
+
+    Py_DECREF( pos_args );
+
+    return result;
+}
+
+#ifdef _NUITKA_CALL_SITE_STATISTICS
+static Nuitka_CallSiteCache *call_site_caches = NULL;
+
+static void dumpCallSiteStatistics( void )
+{
+    fprintf( stderr, "Call site cache statistics:\n" );
+
+    for( Nuitka_CallSiteCache *cache = call_site_caches; cache != NULL; cache = cache->m_next )
+    {
+        // More misses than entries means called objects got evicted.
+        fprintf(
+            stderr,
+            "%s: hits %lu misses %lu%s\n",
+            cache->m_location,
+            cache->m_hits,
+            cache->m_misses,
+            cache->m_misses > NUITKA_CALL_SITE_CACHE_ENTRIES ? " (megamorphic)" : ""
+        );
+    }
+}
+#endif
+
+Nuitka_CallStrategy UPDATE_CALL_SITE_CACHE( Nuitka_CallSiteCache *cache, PyObject *called, PyTypeObject *type, void *key, Py_ssize_t version, Py_ssize_t args_size )
+{
+    // The first entry was checked already.
+    for( int i = 1; i < NUITKA_CALL_SITE_CACHE_ENTRIES; i++ )
+    {
+        Nuitka_CallSiteCacheEntry *entry = &cache->m_entries[ i ];
+
+        if ( entry->m_type == type && entry->m_key == key && entry->m_version == version )
+        {
+#ifdef _NUITKA_CALL_SITE_STATISTICS
+            cache->m_hits += 1;
+#endif
+            return entry->m_strategy;
+        }
+    }
+
+#ifdef _NUITKA_CALL_SITE_STATISTICS
+    if ( cache->m_misses == 0 )
+    {
+        if ( call_site_caches == NULL )
+        {
+            Py_AtExit( dumpCallSiteStatistics );
+        }
+
+        cache->m_next = call_site_caches;
+        call_site_caches = cache;
+    }
+
+    cache->m_misses += 1;
+#endif
+
+    Nuitka_CallStrategy strategy = GET_CALL_STRATEGY( called, args_size );
+
+    // Use a free entry, or else forget about the oldest one.
+    int i = 0;
+
+    while ( i < NUITKA_CALL_SITE_CACHE_ENTRIES - 1 && cache->m_entries[ i ].m_type != NULL )
+    {
+        i += 1;
+    }
+
+    for( ; i > 0; i-- )
+    {
+        cache->m_entries[ i ] = cache->m_entries[ i - 1 ];
+    }
+
+    cache->m_entries[ 0 ].m_type = type;
+    cache->m_entries[ 0 ].m_key = key;
+    cache->m_entries[ 0 ].m_version = version;
+    cache->m_entries[ 0 ].m_strategy = strategy;
+
+    return strategy;
+}
+
 #if defined(_NUITKA_STANDALONE) || _NUITKA_FROZEN > 0
 
 #if _NUITKA_FROZEN > 0
@@ -2896,6 +3402,16 @@ void _initSlotCompare()
     Py_DECREF( r );
 }
 
+PyTypeObject *Nuitka_MethodDescr_Type = NULL;
+
+void _initMethodDescrType()
+{
+    PyObject *descr = PyDict_GetItemString( PyList_Type.tp_dict, "append" );
+    CHECK_OBJECT( descr );
+
+    Nuitka_MethodDescr_Type = Py_TYPE( descr );
+}
+
 #define RICHCOMPARE( t ) ( PyType_HasFeature((t), Py_TPFLAGS_HAVE_RICHCOMPARE) ? (t)->tp_richcompare : NULL )
 
 static inline int adjust_tp_compare( int c )
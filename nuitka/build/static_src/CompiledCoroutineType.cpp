@@ -154,7 +154,28 @@ static void Nuitka_Coroutine_entry_point( Nuitka_CoroutineObject *coroutine )
 }
 
 
-static PyObject *Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObject *value )
+// The compiled coroutine behind what is awaited, if any, so that it can be
+// resumed directly.
+static inline Nuitka_CoroutineObject *Nuitka_Coroutine_get_awaited( PyObject *value )
+{
+    if ( Nuitka_Coroutine_Check( value ) )
+    {
+        return (Nuitka_CoroutineObject *)value;
+    }
+    else if ( Py_TYPE( value ) == &Nuitka_CoroutineWrapper_Type )
+    {
+        return ((Nuitka_CoroutineWrapperObject *)value)->m_coroutine;
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+// Send a value into the coroutine. When it returns, and "returned" is given,
+// the return value is stored there, and NULL is returned without an error set,
+// otherwise a StopIteration exception with it is raised.
+static PyObject *_Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObject *value, PyObject **returned )
 {
     if ( coroutine->m_status == status_Unused && value != NULL && value != Py_None )
     {
@@ -224,7 +245,40 @@ static PyObject *Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObj
         // Continue the yielder function while preventing recursion.
         coroutine->m_running = true;
 
-        swapFiber( &coroutine->m_caller_context, &coroutine->m_yielder_context );
+        // While awaiting a compiled coroutine, that one is resumed directly,
+        // and the coroutine body only when it's done, so a chain of them does
+        // not switch through all the fibers. Exceptions thrown in take the
+        // long way.
+        PyObject *yielded = NULL;
+
+        if ( coroutine->m_yieldfrom != NULL && coroutine->m_exception_type == NULL )
+        {
+            Nuitka_CoroutineObject *awaited = Nuitka_Coroutine_get_awaited( coroutine->m_yieldfrom );
+
+            if ( awaited != NULL )
+            {
+                PyObject *awaited_returned = NULL;
+
+                yielded = _Nuitka_Coroutine_send( awaited, value, &awaited_returned );
+
+                // When done, the body gets the return value of the awaited
+                // coroutine, or NULL for an error set.
+                if ( yielded == NULL )
+                {
+                    coroutine->m_yieldfrom_done = true;
+                    coroutine->m_yielded = awaited_returned;
+                }
+            }
+        }
+
+        if ( yielded != NULL )
+        {
+            coroutine->m_yielded = yielded;
+        }
+        else
+        {
+            swapFiber( &coroutine->m_caller_context, &coroutine->m_yielder_context );
+        }
 
         coroutine->m_running = false;
 
@@ -250,9 +304,17 @@ static PyObject *Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObj
 
             Nuitka_Coroutine_release_closure( coroutine );
 
+            // Give back the stack right away, a finished coroutine that is
+            // still referenced won't run anymore.
+            releaseFiber( &coroutine->m_yielder_context );
+
             PyObject *result = coroutine->m_returned;
 
-            if ( result == Py_None )
+            if ( returned != NULL )
+            {
+                *returned = result;
+            }
+            else if ( result == Py_None )
             {
                 PyErr_SetObject( PyExc_StopIteration, Py_None );
                 Py_DECREF( Py_None );
@@ -282,6 +344,8 @@ static PyObject *Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObj
 
             Nuitka_Coroutine_release_closure( coroutine );
 
+            releaseFiber( &coroutine->m_yielder_context );
+
             assert( ERROR_OCCURRED() );
 
             if ( GET_ERROR_OCCURRED() == PyExc_StopIteration )
@@ -335,6 +399,11 @@ static PyObject *Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObj
     }
 }
 
+static PyObject *Nuitka_Coroutine_send( Nuitka_CoroutineObject *coroutine, PyObject *value )
+{
+    return _Nuitka_Coroutine_send( coroutine, value, NULL );
+}
+
 PyObject *Nuitka_Coroutine_close( Nuitka_CoroutineObject *coroutine, PyObject *args )
 {
     if ( coroutine->m_status == status_Running )
@@ -493,6 +562,11 @@ static void Nuitka_Coroutine_tp_del( Nuitka_CoroutineObject *coroutine )
     RESTORE_ERROR_OCCURRED( error_type, error_value, error_traceback );
 }
 
+// Cache for coroutine objects, try to avoid malloc overhead.
+static Nuitka_CoroutineObject *coroutine_cache_head = NULL;
+static int coroutine_cache_size = 0;
+static const int max_coroutine_cache_size = 1024;
+
 static void Nuitka_Coroutine_tp_dealloc( Nuitka_CoroutineObject *coroutine )
 {
     // Revive temporarily.
@@ -536,7 +610,17 @@ static void Nuitka_Coroutine_tp_dealloc( Nuitka_CoroutineObject *coroutine )
     Py_DECREF( coroutine->m_name );
     Py_DECREF( coroutine->m_qualname );
 
-    PyObject_GC_Del( coroutine );
+    if (likely( coroutine_cache_size < max_coroutine_cache_size ))
+    {
+        coroutine->m_code = (void *)coroutine_cache_head;
+        coroutine_cache_head = coroutine;
+        coroutine_cache_size += 1;
+    }
+    else
+    {
+        PyObject_GC_Del( coroutine );
+    }
+
     RESTORE_ERROR_OCCURRED( save_exception_type, save_exception_value, save_exception_tb );
 }
 
@@ -756,7 +840,20 @@ PyTypeObject Nuitka_CoroutineWrapper_Type = {
 
 PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyCellObject **closure, Py_ssize_t closure_given )
 {
-    Nuitka_CoroutineObject *result = PyObject_GC_New( Nuitka_CoroutineObject, &Nuitka_Coroutine_Type );
+    Nuitka_CoroutineObject *result = coroutine_cache_head;
+
+    if ( result != NULL )
+    {
+        coroutine_cache_head = (Nuitka_CoroutineObject *)coroutine_cache_head->m_code;
+        coroutine_cache_size -= 1;
+
+        PyObject_INIT( result, &Nuitka_Coroutine_Type );
+    }
+    else
+    {
+        result = PyObject_GC_New( Nuitka_CoroutineObject, &Nuitka_Coroutine_Type );
+    }
+
     assert( result != NULL );
 
     result->m_code = (void *)code;
@@ -772,6 +869,7 @@ PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *q
 
     // TODO: Makes no sense with coroutines maybe?
     result->m_yieldfrom = NULL;
+    result->m_yieldfrom_done = false;
 
     // We take ownership of those and received the reference count from the
     // caller.
@@ -794,6 +892,7 @@ PyObject *Nuitka_Coroutine_New( coroutine_code code, PyObject *name, PyObject *q
     result->m_code_object = code_object;
 
     initFiber( &result->m_yielder_context );
+    setFiberStackKey( &result->m_yielder_context, code_object );
 
     Nuitka_GC_Track( result );
     return (PyObject *)result;
@@ -988,6 +1087,19 @@ static PyObject *yieldFromCoroutine( Nuitka_CoroutineObject *generator, PyObject
             }
 
         }
+        else if ( Nuitka_Coroutine_get_awaited( value ) != NULL )
+        {
+            // The return value of a compiled coroutine is taken directly,
+            // without creating a StopIteration exception for it.
+            PyObject *returned = NULL;
+
+            retval = _Nuitka_Coroutine_send( Nuitka_Coroutine_get_awaited( value ), send_value, &returned );
+
+            if ( returned != NULL )
+            {
+                return returned;
+            }
+        }
         else if ( PyGen_CheckExact( value ) || PyCoro_CheckExact( value ) )
         {
             retval = PyGen_Send( (PyGenObject *)value, Py_None );
@@ -1033,6 +1145,32 @@ static PyObject *yieldFromCoroutine( Nuitka_CoroutineObject *generator, PyObject
 
             generator->m_yieldfrom = NULL;
 
+            // The awaited coroutine was resumed directly, and is done now.
+            if ( generator->m_yieldfrom_done )
+            {
+                generator->m_yieldfrom_done = false;
+
+                if ( generator->m_yielded != NULL )
+                {
+                    return generator->m_yielded;
+                }
+
+                PyObject *error = GET_ERROR_OCCURRED();
+
+                if ( error == NULL )
+                {
+                    Py_INCREF( Py_None );
+                    return Py_None;
+                }
+
+                if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
+                {
+                    return ERROR_GET_STOP_ITERATION_VALUE();
+                }
+
+                return NULL;
+            }
+
             send_value = generator->m_yielded;
 
             CHECK_OBJECT( send_value );
@@ -1050,11 +1188,21 @@ PyObject *AWAIT_COROUTINE( Nuitka_CoroutineObject *coroutine, PyObject *awaitabl
     PRINT_NEW_LINE();
 #endif
 
-    PyObject *awaitable_iter = PyCoro_GetAwaitableIter( awaitable );
+    PyObject *awaitable_iter;
 
-    if (unlikely( awaitable_iter == NULL ))
+    // Compiled coroutines are awaited themselves, without a wrapper object.
+    if ( Nuitka_Coroutine_Check( awaitable ) )
     {
-        return NULL;
+        awaitable_iter = INCREASE_REFCOUNT( awaitable );
+    }
+    else
+    {
+        awaitable_iter = PyCoro_GetAwaitableIter( awaitable );
+
+        if (unlikely( awaitable_iter == NULL ))
+        {
+            return NULL;
+        }
     }
 
     PyObject *retval = yieldFromCoroutine( coroutine, awaitable_iter );
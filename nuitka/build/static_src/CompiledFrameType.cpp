@@ -21,9 +21,14 @@
 
 #define OFF( x ) offsetof( PyFrameObject, x )
 
+// Compiled frames have no slots for variables after the frame, so there can
+// be fields of our own.
 struct Nuitka_FrameObject
 {
     PyFrameObject m_frame;
+
+    // Given to a traceback, while the frame cache still has it.
+    bool m_lent_to_traceback;
 };
 
 static PyMemberDef Nuitka_Frame_memberlist[] = {
@@ -190,6 +195,51 @@ static PyObject *Nuitka_Frame_tp_repr( Nuitka_FrameObject *nuitka_frame )
     );
 }
 
+// Frames of functions are given to tracebacks as they are. The frame cache
+// keeps them without a reference meanwhile, and takes them back when they are
+// deallocated. Frames of generators, which keep running in them, and of class
+// bodies, which have their own locals, are still copied.
+static bool canLendFrame( PyFrameObject *frame_object )
+{
+    int flags = frame_object->f_code->co_flags;
+
+#if PYTHON_VERSION < 350
+    return ( flags & ( CO_OPTIMIZED | CO_GENERATOR ) ) == CO_OPTIMIZED;
+#else
+    return ( flags & ( CO_OPTIMIZED | CO_GENERATOR | CO_COROUTINE ) ) == CO_OPTIMIZED;
+#endif
+}
+
+static bool isLentFrame( PyFrameObject *frame_object )
+{
+    return ((Nuitka_FrameObject *)frame_object)->m_lent_to_traceback;
+}
+
+static void setLentFrame( PyFrameObject *frame_object, bool lent )
+{
+    ((Nuitka_FrameObject *)frame_object)->m_lent_to_traceback = lent;
+}
+
+// Make a lent frame usable again, releasing the locals and the caller that
+// were kept for the traceback.
+static void resetLentFrame( PyFrameObject *frame_object )
+{
+    assert( isLentFrame( frame_object ) );
+
+    PyFrameObject *old_back = frame_object->f_back;
+    PyObject *old_locals = frame_object->f_locals;
+
+    setLentFrame( frame_object, false );
+    frame_object->f_back = NULL;
+    frame_object->f_locals = NULL;
+
+    // The garbage collector may have cleared it.
+    frame_object->f_stacktop = frame_object->f_valuestack;
+
+    Py_XDECREF( old_back );
+    Py_XDECREF( old_locals );
+}
+
 static void Nuitka_Frame_tp_dealloc( Nuitka_FrameObject *nuitka_frame )
 {
 #ifndef __NUITKA_NO_ASSERT__
@@ -204,6 +254,17 @@ static void Nuitka_Frame_tp_dealloc( Nuitka_FrameObject *nuitka_frame )
 
     PyFrameObject *frame = &nuitka_frame->m_frame;
 
+    // Back to the frame cache, which still has it. Tracking it again also takes
+    // it out of the garbage collector's list of unreachable objects.
+    if ( isLentFrame( frame ) )
+    {
+        _Py_NewReference( (PyObject *)frame );
+        Nuitka_GC_Track( nuitka_frame );
+
+        resetLentFrame( frame );
+        return;
+    }
+
     // locals
     PyObject **valuestack = frame->f_valuestack;
     for ( PyObject **p = frame->f_localsplus; p < valuestack; p++ )
@@ -253,7 +314,7 @@ static int Nuitka_Frame_tp_traverse( PyFrameObject *frame, visitproc visit, void
     Py_VISIT( frame->f_exc_traceback );
 
     // locals
-    Py_ssize_t slots = frame->f_code->co_nlocals + PyTuple_GET_SIZE( frame->f_code->co_cellvars ) + PyTuple_GET_SIZE( frame->f_code->co_freevars );
+    Py_ssize_t slots = Py_SIZE( frame );
     PyObject **fastlocals = frame->f_localsplus;
     for ( Py_ssize_t i = slots; --i >= 0; ++fastlocals )
     {
@@ -278,7 +339,7 @@ static void Nuitka_Frame_tp_clear( PyFrameObject *frame )
     frame->f_stacktop = NULL;
 
     // locals
-    Py_ssize_t slots = frame->f_code->co_nlocals + PyTuple_GET_SIZE( frame->f_code->co_cellvars ) + PyTuple_GET_SIZE( frame->f_code->co_freevars );
+    Py_ssize_t slots = Py_SIZE( frame );
     PyObject **fastlocals = frame->f_localsplus;
 
     for ( Py_ssize_t i = slots; --i >= 0; ++fastlocals )
@@ -350,13 +411,7 @@ static PyObject *Nuitka_Frame_clear( PyFrameObject *frame )
 
 static PyObject *Nuitka_Frame_sizeof( PyFrameObject *frame )
 {
-    Py_ssize_t slots =
-        frame->f_code->co_stacksize +
-        frame->f_code->co_nlocals +
-        PyTuple_GET_SIZE( frame->f_code->co_cellvars ) +
-        PyTuple_GET_SIZE( frame->f_code->co_freevars );
-
-    return PyInt_FromSsize_t( sizeof( Nuitka_FrameObject ) + slots * sizeof(PyObject *) );
+    return PyInt_FromSsize_t( sizeof( Nuitka_FrameObject ) + Py_SIZE( frame ) * sizeof(PyObject *) );
 }
 
 static PyMethodDef Nuitka_Frame_methods[] =
@@ -427,9 +482,17 @@ static PyFrameObject *MAKE_FRAME( PyCodeObject *code, PyObject *module, bool is_
     PyObject *globals = ((PyModuleObject *)module)->md_dict;
     assert( PyDict_Check( globals ) );
 
+    // Compiled code never uses a value stack, and our code objects declare
+    // none, so frames only get slots for the variables of the code object.
+    assert( code->co_stacksize == 0 );
+
     Py_ssize_t ncells = PyTuple_GET_SIZE( code->co_cellvars );
     Py_ssize_t nfrees = PyTuple_GET_SIZE( code->co_freevars );
-    Py_ssize_t extras = code->co_stacksize + code->co_nlocals + ncells + nfrees;
+    Py_ssize_t extras = code->co_nlocals + ncells + nfrees;
+
+    // Neither do they declare variables, these are C variables. The fields of
+    // "Nuitka_FrameObject" after the frame rely on that.
+    assert( extras == 0 );
 
     Nuitka_FrameObject *result = PyObject_GC_NewVar( Nuitka_FrameObject, &Nuitka_Frame_Type, extras );
 
@@ -442,7 +505,6 @@ static PyFrameObject *MAKE_FRAME( PyCodeObject *code, PyObject *module, bool is_
 
     frame->f_code = code;
 
-    extras = code->co_nlocals + ncells + nfrees;
     frame->f_valuestack = frame->f_localsplus + extras;
 
     for ( Py_ssize_t i = 0; i < extras; i++ )
@@ -503,6 +565,8 @@ static PyFrameObject *MAKE_FRAME( PyCodeObject *code, PyObject *module, bool is_
     frame->f_executing = 0;
 #endif
 
+    result->m_lent_to_traceback = false;
+
     Nuitka_GC_Track( result );
     return (PyFrameObject *)result;
 }
@@ -517,6 +581,117 @@ PyFrameObject *MAKE_FUNCTION_FRAME( PyCodeObject *code, PyObject *module )
     return MAKE_FRAME( code, module, false );
 }
 
+#ifdef _NUITKA_FRAME_CACHE_STATISTICS
+static Nuitka_FrameCache *frame_caches = NULL;
+
+static void dumpFrameCacheStatistics( void )
+{
+    fprintf( stderr, "Frame cache statistics:\n" );
+
+    for( Nuitka_FrameCache *cache = frame_caches; cache != NULL; cache = cache->m_next )
+    {
+        fprintf(
+            stderr,
+            "%s:%d %s: hits %lu misses %lu\n",
+            Nuitka_String_AsString( cache->m_code->co_filename ),
+            cache->m_code->co_firstlineno,
+            Nuitka_String_AsString( cache->m_code->co_name ),
+            cache->m_hits,
+            cache->m_misses
+        );
+    }
+}
+#endif
+
+static PyFrameObject *makeCachedFrame( Nuitka_FrameCache *cache, int index, PyCodeObject *code, PyObject *module )
+{
+#ifdef _NUITKA_FRAME_CACHE_STATISTICS
+    if ( cache->m_code == NULL )
+    {
+        if ( frame_caches == NULL )
+        {
+            Py_AtExit( dumpFrameCacheStatistics );
+        }
+
+        cache->m_code = code;
+        cache->m_next = frame_caches;
+        frame_caches = cache;
+    }
+
+    cache->m_misses += 1;
+#endif
+
+    cache->m_frames[ index ] = MAKE_FUNCTION_FRAME( code, module );
+    return cache->m_frames[ index ];
+}
+
+PyFrameObject *UPDATE_FRAME_CACHE( Nuitka_FrameCache *cache, PyCodeObject *code, PyObject *module )
+{
+    // If all frames are in use, one still kept for a traceback is given up
+    // rather than one of an outer activation.
+    int replace_index = _NUITKA_FRAME_CACHE_DEPTH - 1;
+
+    for( int i = 0; i < _NUITKA_FRAME_CACHE_DEPTH; i++ )
+    {
+        PyFrameObject *frame_object = cache->m_frames[ i ];
+
+        if ( frame_object == NULL )
+        {
+            return makeCachedFrame( cache, i, code, module );
+        }
+
+        // Frames lent to a traceback are not ours to reuse until it is gone.
+        if ( isLentFrame( frame_object ) )
+        {
+            if ( replace_index == _NUITKA_FRAME_CACHE_DEPTH - 1 )
+            {
+                replace_index = i;
+            }
+
+            continue;
+        }
+
+        if ( !isFrameUnusable( frame_object ) )
+        {
+#if PYTHON_VERSION < 340
+            // Might have been last used by another thread.
+            frame_object->f_tstate = PyThreadState_GET();
+#endif
+#ifdef _NUITKA_FRAME_CACHE_STATISTICS
+            cache->m_hits += 1;
+#endif
+            return frame_object;
+        }
+
+        // Frames only the cache still references, but that cannot be reused,
+        // e.g. as they are still linked to a caller, are replaced in place.
+        // Others are in use by outer activations, other threads, or are held
+        // onto elsewhere.
+        if ( Py_REFCNT( frame_object ) == 1 )
+        {
+            Py_DECREF( frame_object );
+
+            return makeCachedFrame( cache, i, code, module );
+        }
+    }
+
+    // Recursing deeper than the cache, a frame is replaced, and the activation
+    // or the traceback using it keeps it alive. A lent frame is then left to
+    // the traceback entirely.
+    PyFrameObject *replaced = cache->m_frames[ replace_index ];
+
+    if ( isLentFrame( replaced ) )
+    {
+        setLentFrame( replaced, false );
+    }
+    else
+    {
+        Py_DECREF( replaced );
+    }
+
+    return makeCachedFrame( cache, replace_index, code, module );
+}
+
 
 extern PyObject *const_str_empty;
 extern PyObject *const_bytes_empty;
@@ -549,7 +724,7 @@ PyCodeObject *MAKE_CODEOBJ( PyObject *filename, PyObject *function_name, int lin
         kw_only_count,       // kw-only count
 #endif
         0,                   // nlocals
-        0,                   // stacksize
+        0,                   // stacksize (compiled code has no value stack)
         flags,               // flags
 #if PYTHON_VERSION < 300
         const_str_empty,     // code (bytecode)
@@ -637,6 +812,49 @@ static PyFrameObject *duplicateFrame( PyFrameObject *old_frame, PyObject *locals
     return new_frame;
 }
 
+void popDetachedFrame( Nuitka_FrameCache *cache, PyTracebackObject *traceback, PyObject *locals )
+{
+    PyFrameObject *frame_object = traceback->tb_frame;
+
+    PyThreadState *tstate = PyThreadState_GET();
+    assert( tstate->frame == frame_object );
+
+    // The traceback keeps the frame, including the locals and its link to the
+    // caller. Frames without a caller would look reusable, so these are copied.
+    if ( canLendFrame( frame_object ) && frame_object->f_back != NULL )
+    {
+        // When recursing deeper than the cache, the frame may have been
+        // replaced there already, and is then the traceback's alone.
+        for( int i = 0; i < _NUITKA_FRAME_CACHE_DEPTH; i++ )
+        {
+            if ( cache->m_frames[ i ] == frame_object )
+            {
+                assert( !isLentFrame( frame_object ) );
+                setLentFrame( frame_object, true );
+
+                // Give up the reference of the cache, the traceback and the
+                // activation still hold theirs.
+                assert( Py_REFCNT( frame_object ) > 2 );
+                Py_DECREF( frame_object );
+
+                break;
+            }
+        }
+
+        PyObject *old_locals = frame_object->f_locals;
+        frame_object->f_locals = locals;
+        Py_XDECREF( old_locals );
+
+        tstate->frame = frame_object->f_back;
+    }
+    else
+    {
+        detachFrame( traceback, locals );
+
+        popFrameStack();
+    }
+}
+
 void detachFrame( PyTracebackObject *traceback, PyObject *locals )
 {
     // Duplicate it.
@@ -79,7 +79,7 @@ static PyObject *Nuitka_Function_tp_call( Nuitka_FunctionObject *function, PyObj
 
             return function->m_c_code( function, args );
         }
-        else if ( function->m_args_simple && args_size + function->m_defaults_given == function->m_args_positional_count )
+        else if ( function->m_args_simple && args_size >= function->m_args_required_count && args_size < function->m_args_positional_count )
         {
 #ifdef _MSC_VER
             PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
@@ -87,15 +87,15 @@ static PyObject *Nuitka_Function_tp_call( Nuitka_FunctionObject *function, PyObj
             PyObject *python_pars[ function->m_args_overall_count ];
 #endif
             memcpy( python_pars, args, args_size * sizeof(PyObject *) );
-            memcpy( python_pars + args_size, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
 
-            for( Py_ssize_t i = 0; i < function->m_args_overall_count; i++ )
-            {
-                Py_INCREF( python_pars[ i ] );
-            }
+            FILL_DEFAULTED_PARAMETERS( function, python_pars, args_size );
 
             return function->m_c_code( function, python_pars );
         }
+        else if ( function->m_args_star_list_reuse && function->m_args_keywords_count == 0 )
+        {
+            return Nuitka_CallFunctionTupleArgsKwArgs( function, tuple_args, NULL, false );
+        }
         else
         {
 #ifdef _MSC_VER
@@ -117,7 +117,7 @@ static PyObject *Nuitka_Function_tp_call( Nuitka_FunctionObject *function, PyObj
     }
     else
     {
-        return Nuitka_CallFunctionPosArgsKwArgs( function, &PyTuple_GET_ITEM( tuple_args, 0 ), PyTuple_GET_SIZE( tuple_args ), kw );
+        return Nuitka_CallFunctionTupleArgsKwArgs( function, tuple_args, kw, false );
     }
 }
 
@@ -127,12 +127,9 @@ static long Nuitka_Function_tp_traverse( Nuitka_FunctionObject *function, visitp
     // to be mostly harmless, as these are strings.
     Py_VISIT( function->m_dict );
 
-    if ( function->m_closure )
+    for( Py_ssize_t i = 0; i < function->m_closure_given; i++ )
     {
-        for( Py_ssize_t i = 0; i < function->m_closure_given; i++ )
-        {
-            Py_VISIT( function->m_closure[i] );
-        }
+        Py_VISIT( function->m_closure[i] );
     }
 
     return 0;
@@ -257,7 +254,7 @@ static int Nuitka_Function_set_code( Nuitka_FunctionObject *object, PyObject *va
 
 static PyObject *Nuitka_Function_get_closure( Nuitka_FunctionObject *object )
 {
-    if ( object->m_closure )
+    if ( object->m_closure_given > 0 )
     {
         PyObject *result = PyTuple_New( object->m_closure_given );
 
@@ -307,6 +304,8 @@ static void onUpdatedDefaultsValue( Nuitka_FunctionObject *function )
     {
         function->m_defaults_given = PyTuple_GET_SIZE( function->m_defaults );
     }
+
+    function->m_args_required_count = function->m_args_positional_count - function->m_defaults_given;
 }
 
 static int Nuitka_Function_set_defaults( Nuitka_FunctionObject *object, PyObject *value )
@@ -498,6 +497,14 @@ static PyMethodDef Nuitka_Function_methods[] =
 };
 
 
+// Cache for function objects, try to avoid malloc overhead. As the closure
+// cells are stored in the object, these are kept by the number of them.
+#define MAX_FUNCTION_CACHE_CLOSURE 8
+
+static Nuitka_FunctionObject *function_cache_heads[ MAX_FUNCTION_CACHE_CLOSURE + 1 ];
+static int function_cache_sizes[ MAX_FUNCTION_CACHE_CLOSURE + 1 ];
+static const int max_function_cache_size = 1024;
+
 static void Nuitka_Function_tp_dealloc( Nuitka_FunctionObject *function )
 {
 #ifndef __NUITKA_NO_ASSERT__
@@ -531,17 +538,23 @@ static void Nuitka_Function_tp_dealloc( Nuitka_FunctionObject *function )
     Py_DECREF( function->m_annotations );
 #endif
 
-    if ( function->m_closure )
-    {
-        for( Py_ssize_t i = 0; i < function->m_closure_given; i++ )
-        {
-            Py_DECREF( function->m_closure[i] );
-        }
+    Py_ssize_t closure_given = function->m_closure_given;
 
-        free( function->m_closure );
+    for( Py_ssize_t i = 0; i < closure_given; i++ )
+    {
+        Py_DECREF( function->m_closure[i] );
     }
 
-    PyObject_GC_Del( function );
+    if ( closure_given <= MAX_FUNCTION_CACHE_CLOSURE && function_cache_sizes[ closure_given ] < max_function_cache_size )
+    {
+        function->m_dict = (PyObject *)function_cache_heads[ closure_given ];
+        function_cache_heads[ closure_given ] = function;
+        function_cache_sizes[ closure_given ] += 1;
+    }
+    else
+    {
+        PyObject_GC_Del( function );
+    }
 
 #ifndef __NUITKA_NO_ASSERT__
     PyThreadState *tstate = PyThreadState_GET();
@@ -563,8 +576,8 @@ PyTypeObject Nuitka_Function_Type =
 {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
     "compiled_function",                            /* tp_name */
-    sizeof(Nuitka_FunctionObject),                  /* tp_basicsize */
-    0,                                              /* tp_itemsize */
+    sizeof(Nuitka_FunctionObject) - sizeof(PyCellObject *), /* tp_basicsize */
+    sizeof(PyCellObject *),                         /* tp_itemsize */
     (destructor)Nuitka_Function_tp_dealloc,         /* tp_dealloc */
     0,                                              /* tp_print */
     0,                                              /* tp_getattr */
@@ -621,7 +634,24 @@ static inline PyObject *make_compiled_function( function_impl_code c_code, PyObj
 static inline PyObject *make_compiled_function( function_impl_code c_code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyObject *defaults, PyObject *kwdefaults, PyObject *annotations, PyObject *module, PyObject *doc, PyCellObject **closure, Py_ssize_t closure_given )
 #endif
 {
-    Nuitka_FunctionObject *result = PyObject_GC_New( Nuitka_FunctionObject, &Nuitka_Function_Type );
+    Nuitka_FunctionObject *result = NULL;
+
+    if ( closure_given <= MAX_FUNCTION_CACHE_CLOSURE )
+    {
+        result = function_cache_heads[ closure_given ];
+    }
+
+    if ( result != NULL )
+    {
+        function_cache_heads[ closure_given ] = (Nuitka_FunctionObject *)result->m_dict;
+        function_cache_sizes[ closure_given ] -= 1;
+
+        PyObject_INIT_VAR( result, &Nuitka_Function_Type, closure_given );
+    }
+    else
+    {
+        result = PyObject_GC_NewVar( Nuitka_FunctionObject, &Nuitka_Function_Type, closure_given );
+    }
 
     assert( result );
 
@@ -641,8 +671,6 @@ static inline PyObject *make_compiled_function( function_impl_code c_code, PyObj
     assert( defaults == Py_None || ( PyTuple_Check( defaults ) && PyTuple_Size( defaults ) > 0 ) );
     result->m_defaults = defaults;
 
-    onUpdatedDefaultsValue( result );
-
 #if PYTHON_VERSION >= 300
     if ( kwdefaults == NULL )
     {
@@ -667,6 +695,8 @@ static inline PyObject *make_compiled_function( function_impl_code c_code, PyObj
         (( code_object->co_flags & CO_VARARGS ) ? 1 : 0) +
         (( code_object->co_flags & CO_VARKEYWORDS ) ? 1 : 0);
 
+    onUpdatedDefaultsValue( result );
+
     result->m_args_simple =
         ( code_object->co_flags & (CO_VARARGS|CO_VARKEYWORDS) ) == 0;
 #if PYTHON_VERSION >= 300
@@ -682,6 +712,9 @@ static inline PyObject *make_compiled_function( function_impl_code c_code, PyObj
         result->m_args_star_list_index = -1;
     }
 
+    // Code generation enables it for the functions that allow it.
+    result->m_args_star_list_reuse = false;
+
     if ( ( code_object->co_flags & CO_VARKEYWORDS ) != 0 )
     {
         result->m_args_star_dict_index = result->m_args_keywords_count;
@@ -707,7 +740,11 @@ static inline PyObject *make_compiled_function( function_impl_code c_code, PyObj
     static long Nuitka_Function_counter = 0;
     result->m_counter = Nuitka_Function_counter++;
 
-    result->m_closure = closure;
+    // The references to the cells are taken over.
+    for( Py_ssize_t i = 0; i < closure_given; i++ )
+    {
+        result->m_closure[i] = closure[i];
+    }
     result->m_closure_given = closure_given;
 
     Nuitka_GC_Track( result );
@@ -1281,7 +1318,7 @@ static Py_ssize_t handleKeywordArgs( Nuitka_FunctionObject const *function, PyOb
 }
 
 
-static bool MAKE_STAR_DICT_DICTIONARY_COPY( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *kw )
+static bool MAKE_STAR_DICT_DICTIONARY_COPY( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *kw, bool kw_given )
 {
     Py_ssize_t star_dict_index = function->m_args_star_dict_index;
     assert( star_dict_index != -1 );
@@ -1290,6 +1327,33 @@ static bool MAKE_STAR_DICT_DICTIONARY_COPY( Nuitka_FunctionObject const *functio
     {
         python_pars[ star_dict_index ] = PyDict_New();
     }
+    else if ( kw_given && Py_REFCNT( kw ) == 1 )
+    {
+        // The caller releases the dictionary after the call, and nothing else
+        // references it, so it can become the parameter value as it is.
+        Py_ssize_t pos = 0;
+        PyObject *key, *value;
+
+        while ( PyDict_Next( kw, &pos, &key, &value ) )
+        {
+#if PYTHON_VERSION < 300
+            if (unlikely( !PyString_Check( key ) && !PyUnicode_Check( key ) ))
+#else
+            if (unlikely( !PyUnicode_Check( key ) ))
+#endif
+            {
+                PyErr_Format(
+                    PyExc_TypeError,
+                    "%s() keywords must be strings",
+                    Nuitka_String_AsString( function->m_name )
+                );
+
+                return false;
+            }
+        }
+
+        python_pars[ star_dict_index ] = INCREASE_REFCOUNT( kw );
+    }
     else if ( ((PyDictObject *)kw)->ma_used > 0 )
     {
 #if PYTHON_VERSION < 330
@@ -1422,14 +1486,14 @@ static bool MAKE_STAR_DICT_DICTIONARY_COPY( Nuitka_FunctionObject const *functio
 
 
 #if PYTHON_VERSION < 300
-static Py_ssize_t handleKeywordArgsWithStarDict( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *kw )
+static Py_ssize_t handleKeywordArgsWithStarDict( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject *kw, bool kw_given )
 #else
-static Py_ssize_t handleKeywordArgsWithStarDict( Nuitka_FunctionObject const *function, PyObject **python_pars, Py_ssize_t *kw_only_found, PyObject *kw )
+static Py_ssize_t handleKeywordArgsWithStarDict( Nuitka_FunctionObject const *function, PyObject **python_pars, Py_ssize_t *kw_only_found, PyObject *kw, bool kw_given )
 #endif
 {
     assert( function->m_args_star_dict_index != -1 );
 
-    if (unlikely( MAKE_STAR_DICT_DICTIONARY_COPY( function, python_pars, kw ) == false ))
+    if (unlikely( MAKE_STAR_DICT_DICTIONARY_COPY( function, python_pars, kw, kw_given ) == false ))
     {
         return -1;
     }
@@ -2093,7 +2157,7 @@ error_exit:
 }
 
 
-static bool parseArgumentsFull( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject **args, Py_ssize_t args_size, PyObject *kw )
+static bool parseArgumentsFull( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject **args, Py_ssize_t args_size, PyObject *kw, bool kw_given )
 {
     Py_ssize_t kw_size = kw ? DICT_SIZE( kw ) : 0;
     Py_ssize_t kw_found;
@@ -2133,9 +2197,9 @@ static bool parseArgumentsFull( Nuitka_FunctionObject const *function, PyObject
     if ( function->m_args_star_dict_index != -1 )
     {
 #if PYTHON_VERSION < 300
-        kw_found = handleKeywordArgsWithStarDict( function, python_pars, kw );
+        kw_found = handleKeywordArgsWithStarDict( function, python_pars, kw, kw_given );
 #else
-        kw_found = handleKeywordArgsWithStarDict( function, python_pars, &kw_only_found, kw );
+        kw_found = handleKeywordArgsWithStarDict( function, python_pars, &kw_only_found, kw, kw_given );
 #endif
         if ( kw_found == -1 ) goto error_exit;
     }
@@ -2224,6 +2288,210 @@ error_exit:
     return false;
 }
 
+// Where the keyword arguments of a call site go in the parameters of the
+// function, remembered for the function code called last. Names that are not
+// parameters get -1. The names are constants, and so are the parameter names
+// of the code, therefore the identity checks will typically be enough.
+static Py_ssize_t const *getKeywordIndexes( Nuitka_FunctionObject const *function, PyObject *kwnames, Nuitka_KeywordIndexes *indexes )
+{
+    if ( indexes->m_key == (void *)function->m_c_code )
+    {
+        return indexes->m_indexes;
+    }
+
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
+
+    if ( indexes->m_indexes == NULL )
+    {
+        indexes->m_indexes = (Py_ssize_t *)malloc( kw_size * sizeof( Py_ssize_t ) );
+
+        if (unlikely( indexes->m_indexes == NULL ))
+        {
+            return NULL;
+        }
+    }
+
+    Py_ssize_t keywords_count = function->m_args_keywords_count;
+    PyObject **varnames = function->m_varnames;
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        PyObject *key = PyTuple_GET_ITEM( kwnames, i );
+        Py_ssize_t index = -1;
+
+        for( Py_ssize_t j = 0; j < keywords_count; j++ )
+        {
+            if ( varnames[ j ] == key )
+            {
+                index = j;
+                break;
+            }
+        }
+
+        if ( index == -1 )
+        {
+            for( Py_ssize_t j = 0; j < keywords_count; j++ )
+            {
+                if ( RICH_COMPARE_BOOL_EQ_NORECURSE( varnames[ j ], key ) )
+                {
+                    index = j;
+                    break;
+                }
+            }
+        }
+
+        indexes->m_indexes[ i ] = index;
+    }
+
+    indexes->m_key = (void *)function->m_c_code;
+
+    return indexes->m_indexes;
+}
+
+static bool parseArgumentsKwNamesDict( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject **args, Py_ssize_t args_size, PyObject *kwnames )
+{
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
+
+    PyObject *kw = _PyDict_NewPresized( kw_size );
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        PyDict_SetItem( kw, PyTuple_GET_ITEM( kwnames, i ), args[ args_size + i ] );
+    }
+
+    bool result = parseArgumentsFull( function, python_pars, args, args_size, kw, true );
+
+    Py_DECREF( kw );
+
+    return result;
+}
+
+// Parse arguments given as positional arguments followed by the values of the
+// keyword arguments named in "kwnames", which are all strings and different.
+static bool parseArgumentsKwNames( Nuitka_FunctionObject const *function, PyObject **python_pars, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes )
+{
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
+    bool result;
+#if PYTHON_VERSION >= 300
+    Py_ssize_t kw_only_found;
+#endif
+#if PYTHON_VERSION >= 330
+    bool kw_only_error;
+#endif
+
+    // Functions with a star dict, and all errors from keyword arguments are
+    // left to the dictionary based parsing.
+    if ( function->m_args_star_dict_index != -1 )
+    {
+        return parseArgumentsKwNamesDict( function, python_pars, args, args_size, kwnames );
+    }
+
+    Py_ssize_t const *kw_indexes = getKeywordIndexes( function, kwnames, indexes );
+
+    if (unlikely( kw_indexes == NULL ))
+    {
+        return parseArgumentsKwNamesDict( function, python_pars, args, args_size, kwnames );
+    }
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        if (unlikely( kw_indexes[ i ] == -1 ))
+        {
+            return parseArgumentsKwNamesDict( function, python_pars, args, args_size, kwnames );
+        }
+    }
+
+#if PYTHON_VERSION >= 300
+    kw_only_found = 0;
+#endif
+
+    for( Py_ssize_t i = 0; i < kw_size; i++ )
+    {
+        Py_ssize_t index = kw_indexes[ i ];
+
+        assert( python_pars[ index ] == NULL );
+        python_pars[ index ] = args[ args_size + i ];
+        Py_INCREF( python_pars[ index ] );
+
+#if PYTHON_VERSION >= 300
+        if ( index >= function->m_args_positional_count )
+        {
+            kw_only_found += 1;
+        }
+#endif
+    }
+
+#if PYTHON_VERSION < 270
+    result = handleArgumentsPlain( function, python_pars, NULL, args, args_size, kw_size, kw_size );
+#elif PYTHON_VERSION < 300
+    result = handleArgumentsPlain( function, python_pars, NULL, args, args_size, kw_size );
+#else
+    result = handleArgumentsPlain( function, python_pars, NULL, args, args_size, kw_size, kw_only_found );
+#endif
+
+    if ( result == false ) goto error_exit;
+
+#if PYTHON_VERSION >= 300
+
+    // For Python3.3 the keyword only errors are all reported at once.
+#if PYTHON_VERSION >= 330
+    kw_only_error = false;
+#endif
+
+    for( Py_ssize_t i = function->m_args_positional_count; i < function->m_args_keywords_count; i++ )
+    {
+        if ( python_pars[ i ] == NULL )
+        {
+            PyObject *arg_name = function->m_varnames[ i ];
+
+            python_pars[ i ] = PyDict_GetItem( function->m_kwdefaults, arg_name );
+
+#if PYTHON_VERSION < 330
+            if (unlikely( python_pars[ i ] == NULL ))
+            {
+                PyErr_Format(
+                    PyExc_TypeError,
+                    "%s() needs keyword-only argument %s",
+                    Nuitka_String_AsString( function->m_name ),
+                    Nuitka_String_AsString( arg_name )
+                );
+
+                goto error_exit;
+            }
+
+            Py_INCREF( python_pars[ i ] );
+#else
+            if ( python_pars[ i ] == NULL )
+            {
+                kw_only_error = true;
+            }
+            else
+            {
+                Py_INCREF( python_pars[ i ] );
+            }
+#endif
+        }
+    }
+
+#if PYTHON_VERSION >= 330
+    if (unlikely( kw_only_error ))
+    {
+        formatErrorTooFewKwOnlyArguments( function, &python_pars[ function->m_args_positional_count ] );
+
+        goto error_exit;
+    }
+#endif
+
+#endif
+
+    return true;
+
+error_exit:
+
+    releaseParameters( function, python_pars );
+    return false;
+}
+
 PyObject *Nuitka_CallFunctionPosArgsKwArgs( Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kw )
 {
 #ifdef _MSC_VER
@@ -2233,7 +2501,45 @@ PyObject *Nuitka_CallFunctionPosArgsKwArgs( Nuitka_FunctionObject const *functio
 #endif
     memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
 
-    if (!parseArgumentsFull( function, python_pars, args, args_size, kw )) return NULL;
+    if (!parseArgumentsFull( function, python_pars, args, args_size, kw, false )) return NULL;
+    return function->m_c_code( function, python_pars );
+}
+
+PyObject *Nuitka_CallFunctionTupleArgsKwArgs( Nuitka_FunctionObject const *function, PyObject *tuple_args, PyObject *kw, bool kw_given )
+{
+#ifdef _MSC_VER
+    PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+    PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+    memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
+
+    // Functions taking all positional arguments as their star list, e.g.
+    // wrappers, can use the tuple as it is, if they only pass it on. Others
+    // could tell it apart from the new tuple CPython gives them.
+    if ( function->m_args_star_list_reuse && function->m_args_keywords_count == 0 && PyTuple_CheckExact( tuple_args ) )
+    {
+        if ( function->m_args_star_dict_index != -1 )
+        {
+            if (unlikely( MAKE_STAR_DICT_DICTIONARY_COPY( function, python_pars, kw, kw_given ) == false ))
+            {
+                releaseParameters( function, python_pars );
+                return NULL;
+            }
+
+            python_pars[ function->m_args_star_list_index ] = INCREASE_REFCOUNT( tuple_args );
+
+            return function->m_c_code( function, python_pars );
+        }
+        else if ( kw == NULL || DICT_SIZE( kw ) == 0 )
+        {
+            python_pars[ function->m_args_star_list_index ] = INCREASE_REFCOUNT( tuple_args );
+
+            return function->m_c_code( function, python_pars );
+        }
+    }
+
+    if (!parseArgumentsFull( function, python_pars, &PyTuple_GET_ITEM( tuple_args, 0 ), PyTuple_GET_SIZE( tuple_args ), kw, kw_given )) return NULL;
     return function->m_c_code( function, python_pars );
 }
 
@@ -2326,6 +2632,39 @@ error_exit:
 
 PyObject *Nuitka_CallMethodFunctionPosArgsKwArgs( Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kw )
 {
+    // Without keyword arguments, the object and the positional arguments can
+    // be passed without parsing for simple functions, and without copying
+    // them first for the others.
+    if ( kw == NULL || DICT_SIZE( kw ) == 0 )
+    {
+        if ( function->m_args_simple && args_size + 1 >= function->m_args_required_count && args_size + 1 <= function->m_args_positional_count )
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
+#else
+            PyObject *python_pars[ function->m_args_positional_count ];
+#endif
+            python_pars[ 0 ] = object;
+            memcpy( python_pars + 1, args, args_size * sizeof( PyObject * ) );
+
+            FILL_DEFAULTED_PARAMETERS( function, python_pars, args_size + 1 );
+
+            return function->m_c_code( function, python_pars );
+        }
+        else
+        {
+#ifdef _MSC_VER
+            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+            PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+            memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
+
+            if (!parseArgumentsMethodPos( function, python_pars, object, args, args_size )) return NULL;
+            return function->m_c_code( function, python_pars );
+        }
+    }
+
 #ifdef _MSC_VER
     PyObject **new_args = (PyObject **)_alloca( sizeof( PyObject * ) *( args_size + 1 ) );
 #else
@@ -2334,6 +2673,33 @@ PyObject *Nuitka_CallMethodFunctionPosArgsKwArgs( Nuitka_FunctionObject const *f
     new_args[ 0 ] = object;
     memcpy( new_args + 1, args, args_size * sizeof( PyObject *) );
 
-    // TODO: Specialize implementation for massive gains.
     return Nuitka_CallFunctionPosArgsKwArgs( function, new_args, args_size + 1, kw );
 }
+
+PyObject *Nuitka_CallFunctionKwNames( Nuitka_FunctionObject const *function, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes )
+{
+#ifdef _MSC_VER
+    PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+    PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+    memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
+
+    if (!parseArgumentsKwNames( function, python_pars, args, args_size, kwnames, indexes )) return NULL;
+    return function->m_c_code( function, python_pars );
+}
+
+PyObject *Nuitka_CallMethodFunctionKwNames( Nuitka_FunctionObject const *function, PyObject *object, PyObject **args, Py_ssize_t args_size, PyObject *kwnames, Nuitka_KeywordIndexes *indexes )
+{
+    Py_ssize_t kw_size = PyTuple_GET_SIZE( kwnames );
+
+#ifdef _MSC_VER
+    PyObject **new_args = (PyObject **)_alloca( sizeof( PyObject * ) *( args_size + kw_size + 1 ) );
+#else
+    PyObject *new_args[ args_size + kw_size + 1 ];
+#endif
+    new_args[ 0 ] = object;
+    memcpy( new_args + 1, args, ( args_size + kw_size ) * sizeof( PyObject *) );
+
+    return Nuitka_CallFunctionKwNames( function, new_args, args_size + 1, kwnames, indexes );
+}
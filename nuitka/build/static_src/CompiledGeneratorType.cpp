@@ -44,6 +44,13 @@ static long Nuitka_Generator_tp_traverse( Nuitka_GeneratorObject *generator, vis
     // Not needed.
     // Py_VISIT( (PyObject *)generator->m_frame );
 
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    for( int i = generator->m_batch_index; i < generator->m_batch_count; i++ )
+    {
+        Py_VISIT( generator->m_batch[ i ] );
+    }
+#endif
+
     return 0;
 }
 
@@ -61,6 +68,7 @@ static void Nuitka_Generator_release_closure( Nuitka_GeneratorObject *generator
     }
 }
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
 // For the generator object fiber entry point, we may need to follow what
 // "makecontext" will support and that is only a list of integers, but we will need
 // to push a pointer through it, and so it's two of them, which might be fully
@@ -85,9 +93,95 @@ static void Nuitka_Generator_entry_point( Nuitka_GeneratorObject *generator )
 
     swapFiber( &generator->m_yielder_context, &generator->m_caller_context );
 }
+#else
+static void Nuitka_Generator_release_heap_storage( Nuitka_GeneratorObject *generator )
+{
+    if ( generator->m_heap_storage )
+    {
+        free( generator->m_heap_storage );
+        generator->m_heap_storage = NULL;
+    }
 
-static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObject *value )
+#if PYTHON_VERSION >= 330
+    Py_XDECREF( generator->m_yieldfrom );
+    generator->m_yieldfrom = NULL;
+#endif
+}
+
+#if PYTHON_VERSION >= 330
+static PyObject *Nuitka_Generator_yieldfrom( Nuitka_GeneratorObject *generator, PyObject *send_value );
+#endif
+#endif
+
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+// Give out the values yielded ahead, and after them, the exception the body
+// raised, if any. Returns false if there is nothing left.
+static bool Nuitka_Generator_get_batched( Nuitka_GeneratorObject *generator, PyObject **result )
 {
+    if ( generator->m_batch_index < generator->m_batch_count )
+    {
+        *result = generator->m_batch[ generator->m_batch_index++ ];
+        return true;
+    }
+
+    if ( generator->m_batch_exception_type != NULL )
+    {
+        RESTORE_ERROR_OCCURRED(
+            generator->m_batch_exception_type,
+            generator->m_batch_exception_value,
+            generator->m_batch_exception_tb
+        );
+
+        generator->m_batch_exception_type = NULL;
+        generator->m_batch_exception_value = NULL;
+        generator->m_batch_exception_tb = NULL;
+
+        *result = NULL;
+        return true;
+    }
+
+    return false;
+}
+
+// When thrown into or closed, the values yielded ahead are not given out
+// anymore.
+static void Nuitka_Generator_discard_batched( Nuitka_GeneratorObject *generator )
+{
+    while ( generator->m_batch_index < generator->m_batch_count )
+    {
+        Py_DECREF( generator->m_batch[ generator->m_batch_index++ ] );
+    }
+
+    generator->m_batch_index = 0;
+    generator->m_batch_count = 0;
+
+    Py_XDECREF( generator->m_batch_exception_type );
+    Py_XDECREF( generator->m_batch_exception_value );
+    Py_XDECREF( generator->m_batch_exception_tb );
+
+    generator->m_batch_exception_type = NULL;
+    generator->m_batch_exception_value = NULL;
+    generator->m_batch_exception_tb = NULL;
+}
+#endif
+
+// Send a value into the generator. When it is exhausted, NULL is returned
+// without an exception set, like "tp_iternext" may do, so that compiled code
+// does not have to raise and clear StopIteration for it.
+static PyObject *_Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObject *value )
+{
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    // The yields of values given ahead did not use the sent value.
+    {
+        PyObject *result;
+
+        if ( Nuitka_Generator_get_batched( generator, &result ) )
+        {
+            return result;
+        }
+    }
+#endif
+
     if ( generator->m_status == status_Unused && value != NULL && value != Py_None )
     {
         PyErr_Format( PyExc_TypeError, "can't send non-None value to a just-started generator" );
@@ -115,6 +209,7 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
 
         if ( generator->m_status == status_Unused )
         {
+#ifndef _NUITKA_STACKLESS_GENERATORS
             // Prepare the generator context to run.
             int res = prepareFiber( &generator->m_yielder_context, (void *)Nuitka_Generator_entry_point, (uintptr_t)generator );
 
@@ -123,6 +218,7 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
                 PyErr_Format( PyExc_MemoryError, "generator cannot be allocated" );
                 return NULL;
             }
+#endif
 
             generator->m_status = status_Running;
         }
@@ -156,7 +252,51 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
         // Continue the yielder function while preventing recursion.
         generator->m_running = true;
 
-        swapFiber( &generator->m_caller_context, &generator->m_yielder_context );
+#ifndef _NUITKA_STACKLESS_GENERATORS
+#if PYTHON_VERSION >= 330
+        // While delegating with "yield from" to a compiled generator, that one
+        // is resumed directly, and the generator body only when it's done, so
+        // a chain of them does not switch through all the fibers. Exceptions
+        // thrown in, and handlers that swap the exception, take the long way.
+        PyObject *yielded = NULL;
+
+        if ( generator->m_yieldfrom != NULL && generator->m_exception_type == NULL && !generator->m_yieldfrom_in_handler && Nuitka_Generator_Check( generator->m_yieldfrom ) )
+        {
+            yielded = _Nuitka_Generator_send( (Nuitka_GeneratorObject *)generator->m_yieldfrom, value );
+
+            generator->m_yieldfrom_done = yielded == NULL;
+        }
+
+        if ( yielded != NULL )
+        {
+            generator->m_yielded = yielded;
+        }
+        else
+#endif
+        {
+            swapFiber( &generator->m_caller_context, &generator->m_yielder_context );
+        }
+#else
+#if PYTHON_VERSION >= 330
+        // While delegating with "yield from", the sub-generator gives the
+        // values, and the generator body is resumed only when it's done.
+        PyObject *yielded = NULL;
+
+        if ( generator->m_yieldfrom )
+        {
+            yielded = Nuitka_Generator_yieldfrom( generator, value );
+        }
+
+        if ( yielded != NULL )
+        {
+            generator->m_yielded = yielded;
+        }
+        else
+#endif
+        {
+            ((generator_code)generator->m_code)( generator );
+        }
+#endif
 
         generator->m_running = false;
 
@@ -175,8 +315,6 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
 
         if ( generator->m_yielded == NULL )
         {
-            assert( ERROR_OCCURRED() );
-
             generator->m_status = status_Finished;
 
             Py_XDECREF( generator->m_frame );
@@ -184,7 +322,13 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
 
             Nuitka_Generator_release_closure( generator );
 
-            assert( ERROR_OCCURRED() );
+            // Give back the stack right away, a finished generator that is
+            // still referenced won't run anymore.
+#ifndef _NUITKA_STACKLESS_GENERATORS
+            releaseFiber( &generator->m_yielder_context );
+#else
+            Nuitka_Generator_release_heap_storage( generator );
+#endif
 
 #if PYTHON_VERSION < 300
             Py_XDECREF( saved_exception_type );
@@ -231,6 +375,20 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
             }
 #endif
 
+#if PYTHON_VERSION >= 330
+            // The returned value is given after the above, a StopIteration
+            // raised for it is not escaping the body.
+            if ( generator->m_returned != NULL )
+            {
+                assert( !ERROR_OCCURRED() );
+
+                RESTORE_ERROR_OCCURRED( PyExc_StopIteration, generator->m_returned, NULL );
+                Py_INCREF( PyExc_StopIteration );
+
+                generator->m_returned = NULL;
+            }
+#endif
+
             return NULL;
         }
         else
@@ -244,22 +402,81 @@ static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObj
     }
     else
     {
-        PyErr_SetObject( PyExc_StopIteration, (PyObject *)NULL );
-
         return NULL;
     }
 }
 
+static PyObject *Nuitka_Generator_send( Nuitka_GeneratorObject *generator, PyObject *value )
+{
+    PyObject *result = _Nuitka_Generator_send( generator, value );
+
+    // Only callers of the "send" method need the StopIteration exception.
+    if ( result == NULL && !ERROR_OCCURRED() )
+    {
+        RESTORE_ERROR_OCCURRED( PyExc_StopIteration, NULL, NULL );
+        Py_INCREF( PyExc_StopIteration );
+    }
+
+    return result;
+}
+
 static PyObject *Nuitka_Generator_tp_iternext( Nuitka_GeneratorObject *generator )
 {
-    return Nuitka_Generator_send( generator, Py_None );
+    return _Nuitka_Generator_send( generator, Py_None );
 }
 
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+PyObject *Nuitka_Generator_iternext_batched( Nuitka_GeneratorObject *generator )
+{
+    PyObject *result;
+
+    if ( Nuitka_Generator_get_batched( generator, &result ) )
+    {
+        return result;
+    }
+
+    // The body may yield values ahead, but the last one is yielded normally,
+    // to switch back.
+    generator->m_batch_index = 0;
+    generator->m_batch_count = 0;
+    generator->m_batch_limit = _NUITKA_GENERATOR_BATCH_SIZE - 1;
+
+    result = _Nuitka_Generator_send( generator, Py_None );
+
+    generator->m_batch_limit = 0;
+
+    if ( generator->m_batch_count == 0 )
+    {
+        return result;
+    }
+
+    if ( result != NULL )
+    {
+        generator->m_batch[ generator->m_batch_count++ ] = result;
+    }
+    else
+    {
+        FETCH_ERROR_OCCURRED(
+            &generator->m_batch_exception_type,
+            &generator->m_batch_exception_value,
+            &generator->m_batch_exception_tb
+        );
+    }
+
+    generator->m_batch_index = 1;
+    return generator->m_batch[ 0 ];
+}
+#endif
+
 #if PYTHON_VERSION < 340
 static
 #endif
 PyObject *Nuitka_Generator_close( Nuitka_GeneratorObject *generator, PyObject *args )
 {
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    Nuitka_Generator_discard_batched( generator );
+#endif
+
     if ( generator->m_status == status_Running )
     {
         generator->m_exception_type = INCREASE_REFCOUNT( PyExc_GeneratorExit );
@@ -296,6 +513,10 @@ PyObject *Nuitka_Generator_close( Nuitka_GeneratorObject *generator, PyObject *a
 
 static PyObject *Nuitka_Generator_throw( Nuitka_GeneratorObject *generator, PyObject *args )
 {
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    Nuitka_Generator_discard_batched( generator );
+#endif
+
     assert( generator->m_exception_type == NULL );
     assert( generator->m_exception_value == NULL );
     assert( generator->m_exception_tb == NULL );
@@ -422,6 +643,11 @@ static void Nuitka_Generator_tp_del( Nuitka_GeneratorObject *generator )
 }
 #endif
 
+// Cache for generator objects, try to avoid malloc overhead.
+static Nuitka_GeneratorObject *generator_cache_head = NULL;
+static int generator_cache_size = 0;
+static const int max_generator_cache_size = 1024;
+
 static void Nuitka_Generator_tp_dealloc( Nuitka_GeneratorObject *generator )
 {
     // Revive temporarily.
@@ -449,12 +675,20 @@ static void Nuitka_Generator_tp_dealloc( Nuitka_GeneratorObject *generator )
 
     Nuitka_Generator_release_closure( generator );
 
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    Nuitka_Generator_discard_batched( generator );
+#endif
+
     Py_XDECREF( generator->m_frame );
 
     assert( Py_REFCNT( generator ) == 1 );
     Py_REFCNT( generator ) = 0;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     releaseFiber( &generator->m_yielder_context );
+#else
+    Nuitka_Generator_release_heap_storage( generator );
+#endif
 
     // Now it is safe to release references and memory for it.
     Nuitka_GC_UnTrack( generator );
@@ -471,7 +705,17 @@ static void Nuitka_Generator_tp_dealloc( Nuitka_GeneratorObject *generator )
     Py_DECREF( generator->m_qualname );
 #endif
 
-    PyObject_GC_Del( generator );
+    if (likely( generator_cache_size < max_generator_cache_size ))
+    {
+        generator->m_code = (void *)generator_cache_head;
+        generator_cache_head = generator;
+        generator_cache_size += 1;
+    }
+    else
+    {
+        PyObject_GC_Del( generator );
+    }
+
     RESTORE_ERROR_OCCURRED( save_exception_type, save_exception_value, save_exception_tb );
 }
 
@@ -675,7 +919,20 @@ PyObject *Nuitka_Generator_New( generator_code code, PyObject *name, PyCodeObjec
 PyObject *Nuitka_Generator_New( generator_code code, PyObject *name, PyObject *qualname, PyCodeObject *code_object, PyCellObject **closure, Py_ssize_t closure_given )
 #endif
 {
-    Nuitka_GeneratorObject *result = PyObject_GC_New( Nuitka_GeneratorObject, &Nuitka_Generator_Type );
+    Nuitka_GeneratorObject *result = generator_cache_head;
+
+    if ( result != NULL )
+    {
+        generator_cache_head = (Nuitka_GeneratorObject *)generator_cache_head->m_code;
+        generator_cache_size -= 1;
+
+        PyObject_INIT( result, &Nuitka_Generator_Type );
+    }
+    else
+    {
+        result = PyObject_GC_New( Nuitka_GeneratorObject, &Nuitka_Generator_Type );
+    }
+
     assert( result != NULL );
 
     result->m_code = (void *)code;
@@ -690,7 +947,12 @@ PyObject *Nuitka_Generator_New( generator_code code, PyObject *name, PyObject *q
     result->m_qualname = qualname;
     Py_INCREF( qualname );
 
+#endif
+
+#if PYTHON_VERSION >= 330
     result->m_yieldfrom = NULL;
+    result->m_yieldfrom_in_handler = false;
+    result->m_returned = NULL;
 #endif
 
     // We take ownership of those and received the reference count from the
@@ -712,7 +974,27 @@ PyObject *Nuitka_Generator_New( generator_code code, PyObject *name, PyObject *q
     result->m_frame = NULL;
     result->m_code_object = code_object;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
     initFiber( &result->m_yielder_context );
+    setFiberStackKey( &result->m_yielder_context, code_object );
+
+#if PYTHON_VERSION >= 330
+    result->m_yieldfrom_done = false;
+#endif
+#else
+    result->m_yield_return_index = 0;
+    result->m_heap_storage = NULL;
+#endif
+
+#ifdef _NUITKA_GENERATOR_BATCH_SIZE
+    result->m_batch_index = 0;
+    result->m_batch_count = 0;
+    result->m_batch_limit = 0;
+
+    result->m_batch_exception_type = NULL;
+    result->m_batch_exception_value = NULL;
+    result->m_batch_exception_tb = NULL;
+#endif
 
     Nuitka_GC_Track( result );
     return (PyObject *)result;
@@ -884,6 +1166,26 @@ extern PyObject *ERROR_GET_STOP_ITERATION_VALUE();
 
 extern PyObject *const_str_plain_send, *const_str_plain_throw, *const_str_plain_close;
 
+#ifndef _NUITKA_STACKLESS_GENERATORS
+// The sub-generator is done, the value of the "yield from" is given by the
+// StopIteration it raised, or NULL for other errors, which need to be raised.
+static PyObject *_YIELD_FROM_RESULT( void )
+{
+    PyObject *error = GET_ERROR_OCCURRED();
+
+    if ( error == NULL )
+    {
+        return INCREASE_REFCOUNT( Py_None );
+    }
+
+    if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
+    {
+        return ERROR_GET_STOP_ITERATION_VALUE();
+    }
+
+    return NULL;
+}
+
 static PyObject *_YIELD_FROM( Nuitka_GeneratorObject *generator, PyObject *value )
 {
     // This is the value, propagated back and forth the sub-generator and the
@@ -975,6 +1277,10 @@ static PyObject *_YIELD_FROM( Nuitka_GeneratorObject *generator, PyObject *value
             }
 
         }
+        else if ( Nuitka_Generator_Check( value ) )
+        {
+            retval = _Nuitka_Generator_send( (Nuitka_GeneratorObject *)value, send_value );
+        }
         else if ( PyGen_CheckExact( value ) )
         {
             retval = PyGen_Send( (PyGenObject *)value, Py_None );
@@ -997,36 +1303,31 @@ static PyObject *_YIELD_FROM( Nuitka_GeneratorObject *generator, PyObject *value
         // Check the sub-generator result
         if ( retval == NULL )
         {
-            PyObject *error = GET_ERROR_OCCURRED();
-            if ( error == NULL )
-            {
-                return INCREASE_REFCOUNT( Py_None ) ;
-            }
-
             // The sub-generator has given an exception. In case of
             // StopIteration, we need to check the value, as it is going to be
             // the expression value of this "yield from", and we are done. All
             // other errors, we need to raise.
-            if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
-            {
-                return ERROR_GET_STOP_ITERATION_VALUE();
-            }
-
-            return NULL;
+            return _YIELD_FROM_RESULT();
         }
         else
         {
             generator->m_yielded = retval;
 
-#if PYTHON_VERSION >= 350
             generator->m_yieldfrom = value;
-#endif
+            generator->m_yieldfrom_in_handler = false;
+
             // Return to the calling context.
             swapFiber( &generator->m_yielder_context, &generator->m_caller_context );
 
-#if PYTHON_VERSION >= 350
             generator->m_yieldfrom = NULL;
-#endif
+
+            // The sub-generator was resumed directly, and is done now.
+            if ( generator->m_yieldfrom_done )
+            {
+                generator->m_yieldfrom_done = false;
+
+                return _YIELD_FROM_RESULT();
+            }
 
             send_value = generator->m_yielded;
 
@@ -1161,6 +1462,10 @@ static PyObject *_YIELD_FROM_IN_HANDLER( Nuitka_GeneratorObject *generator, PyOb
             }
 
         }
+        else if ( Nuitka_Generator_Check( value ) )
+        {
+            retval = _Nuitka_Generator_send( (Nuitka_GeneratorObject *)value, send_value );
+        }
         else if ( PyGen_CheckExact( value ) )
         {
             retval = PyGen_Send( (PyGenObject *)value, Py_None );
@@ -1219,15 +1524,13 @@ static PyObject *_YIELD_FROM_IN_HANDLER( Nuitka_GeneratorObject *generator, PyOb
             thread_state->frame->f_exc_value = saved_exception_value;
             thread_state->frame->f_exc_traceback = saved_exception_traceback;
 
-#if PYTHON_VERSION >= 350
             generator->m_yieldfrom = value;
-#endif
+            generator->m_yieldfrom_in_handler = true;
+
             // Return to the calling context.
             swapFiber( &generator->m_yielder_context, &generator->m_caller_context );
 
-#if PYTHON_VERSION >= 350
             generator->m_yieldfrom = NULL;
-#endif
             // When returning from yield, the exception of the frame is preserved, and
             // the one that enters should be there.
             thread_state = PyThreadState_GET();
@@ -1287,6 +1590,254 @@ PyObject *YIELD_FROM_IN_HANDLER( Nuitka_GeneratorObject *generator, PyObject *ta
     }
 }
 
+#else
+
+// Send a value, or the exception thrown into the generator, to the
+// sub-generator of "yield from", and return what it yields. When it is done,
+// NULL is returned, and the result of the "yield from" is in "m_yielded", or
+// the exception it gave is in "m_exception_type", so that "YIELD_FROM_RESUME"
+// of the generator body picks it up.
+static PyObject *Nuitka_Generator_yieldfrom_step( Nuitka_GeneratorObject *generator, PyObject *send_value )
+{
+    PyObject *value = generator->m_yieldfrom;
+    CHECK_OBJECT( value );
+
+    PyObject *retval;
+
+    // Exception, was thrown into us, need to send that to sub-generator.
+    if ( generator->m_exception_type )
+    {
+        // The yielding generator is being closed, but we also are tasked to
+        // immediately close the currently running sub-generator.
+        if ( EXCEPTION_MATCH_BOOL_SINGLE( generator->m_exception_type, PyExc_GeneratorExit ) )
+        {
+            PyObject *close_method = PyObject_GetAttr( value, const_str_plain_close );
+
+            if ( close_method )
+            {
+                PyObject *close_value = PyObject_Call( close_method, const_tuple_empty, NULL );
+                Py_DECREF( close_method );
+
+                if (unlikely( close_value == NULL ))
+                {
+                    // The error from closing replaces the exception thrown in.
+                    Py_DECREF( generator->m_exception_type );
+                    Py_XDECREF( generator->m_exception_value );
+                    Py_XDECREF( generator->m_exception_tb );
+
+                    FETCH_ERROR_OCCURRED( &generator->m_exception_type, &generator->m_exception_value, &generator->m_exception_tb );
+
+                    goto finished;
+                }
+
+                Py_DECREF( close_value );
+            }
+            else
+            {
+                PyObject *error = GET_ERROR_OCCURRED();
+
+                if ( error != NULL && !EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_AttributeError ) )
+                {
+                    PyErr_WriteUnraisable( (PyObject *)value );
+                }
+                else
+                {
+                    CLEAR_ERROR_OCCURRED();
+                }
+            }
+
+            // The exception thrown in is raised by the generator body.
+            goto finished;
+        }
+
+        PyObject *throw_method = PyObject_GetAttr( value, const_str_plain_throw );
+
+        if ( throw_method )
+        {
+            retval = PyObject_CallFunctionObjArgs( throw_method, generator->m_exception_type, generator->m_exception_value, generator->m_exception_tb, NULL );
+            Py_DECREF( throw_method );
+
+            Py_CLEAR( generator->m_exception_type );
+            Py_CLEAR( generator->m_exception_value );
+            Py_CLEAR( generator->m_exception_tb );
+        }
+        else if ( EXCEPTION_MATCH_BOOL_SINGLE( GET_ERROR_OCCURRED(), PyExc_AttributeError ) )
+        {
+            CLEAR_ERROR_OCCURRED();
+
+            // The exception thrown in is raised by the generator body.
+            goto finished;
+        }
+        else
+        {
+            assert( ERROR_OCCURRED() );
+
+            Py_CLEAR( generator->m_exception_type );
+            Py_CLEAR( generator->m_exception_value );
+            Py_CLEAR( generator->m_exception_tb );
+
+            FETCH_ERROR_OCCURRED( &generator->m_exception_type, &generator->m_exception_value, &generator->m_exception_tb );
+
+            goto finished;
+        }
+    }
+    else if ( Nuitka_Generator_Check( value ) )
+    {
+        retval = _Nuitka_Generator_send( (Nuitka_GeneratorObject *)value, send_value );
+    }
+    else if ( PyGen_CheckExact( value ) )
+    {
+        retval = PyGen_Send( (PyGenObject *)value, send_value );
+    }
+    else if ( send_value == Py_None && Py_TYPE( value )->tp_iternext != NULL )
+    {
+        retval = Py_TYPE( value )->tp_iternext( value );
+    }
+    else
+    {
+        // Bug compatibility here, before 3.3 tuples were unrolled in calls, which is what
+        // PyObject_CallMethod does.
+#if PYTHON_VERSION >= 340
+        retval = PyObject_CallMethodObjArgs( value, const_str_plain_send, send_value, NULL );
+#else
+        retval = PyObject_CallMethod( value, (char *)"send", (char *)"O", send_value );
+#endif
+    }
+
+    // The sub-generator yielded a value, delegation continues.
+    if ( retval != NULL )
+    {
+        return retval;
+    }
+
+    {
+        PyObject *error = GET_ERROR_OCCURRED();
+
+        // The sub-generator has given an exception. In case of StopIteration,
+        // we need to check the value, as it is going to be the expression
+        // value of this "yield from", and we are done. All other errors, we
+        // need to raise.
+        if ( error == NULL )
+        {
+            generator->m_yielded = INCREASE_REFCOUNT( Py_None );
+        }
+        else if (likely( EXCEPTION_MATCH_BOOL_SINGLE( error, PyExc_StopIteration ) ))
+        {
+            generator->m_yielded = ERROR_GET_STOP_ITERATION_VALUE();
+        }
+        else
+        {
+            FETCH_ERROR_OCCURRED( &generator->m_exception_type, &generator->m_exception_value, &generator->m_exception_tb );
+        }
+    }
+
+finished:
+    Py_DECREF( generator->m_yieldfrom );
+    generator->m_yieldfrom = NULL;
+
+    return NULL;
+}
+
+static PyObject *Nuitka_Generator_yieldfrom( Nuitka_GeneratorObject *generator, PyObject *send_value )
+{
+    // The sub-generator of a "yield from" in an exception handler is to see
+    // the exception of the handler, not the one of the caller.
+    if ( generator->m_yieldfrom_in_handler )
+    {
+        SWAP_GENERATOR_EXCEPTION();
+    }
+
+    PyObject *yielded = Nuitka_Generator_yieldfrom_step( generator, send_value );
+
+    if ( yielded != NULL && generator->m_yieldfrom_in_handler )
+    {
+        SWAP_GENERATOR_EXCEPTION();
+    }
+
+    return yielded;
+}
+
+static bool _YIELD_FROM_START( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *target, bool in_handler )
+{
+    PyObject *value;
+
+#if PYTHON_VERSION >= 350
+    if ( PyCoro_CheckExact( target ) || Nuitka_Coroutine_Check( target ))
+    {
+        if (unlikely( (generator->m_code_object->co_flags & CO_ITERABLE_COROUTINE) == 0 ))
+        {
+            PyErr_SetString(
+                PyExc_TypeError,
+                "cannot 'yield from' a coroutine object in a non-coroutine generator"
+            );
+
+            FETCH_ERROR_OCCURRED( &generator->m_exception_type, &generator->m_exception_value, &generator->m_exception_tb );
+            return false;
+        }
+
+        value = INCREASE_REFCOUNT( target );
+    }
+    else
+#endif
+    {
+        value = MAKE_ITERATOR( target );
+
+        if (unlikely( value == NULL ))
+        {
+            FETCH_ERROR_OCCURRED( &generator->m_exception_type, &generator->m_exception_value, &generator->m_exception_tb );
+            return false;
+        }
+    }
+
+    generator->m_yieldfrom = value;
+    generator->m_yieldfrom_in_handler = in_handler;
+
+    PyObject *yielded = Nuitka_Generator_yieldfrom_step( generator, Py_None );
+
+    // The sub-generator may be done immediately, then the generator body is
+    // not suspended at all.
+    if ( yielded == NULL )
+    {
+        return false;
+    }
+
+    if ( in_handler )
+    {
+        SWAP_GENERATOR_EXCEPTION();
+    }
+
+    generator->m_yielded = yielded;
+    generator->m_yield_return_index = yield_return_index;
+
+    return true;
+}
+
+static bool _YIELD_FROM_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *target, bool in_handler )
+{
+    bool result = _YIELD_FROM_START( generator, yield_return_index, target, in_handler );
+
+    // Like for "yield", the frame is not executing until resumed. That is
+    // also the case when not suspended at all, as "YIELD_FROM_RESUME" is
+    // reached either way.
+#if PYTHON_VERSION >= 340
+    generator->m_frame->f_executing -= 1;
+#endif
+
+    return result;
+}
+
+bool YIELD_FROM_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *target )
+{
+    return _YIELD_FROM_SUSPEND( generator, yield_return_index, target, false );
+}
+
+bool YIELD_FROM_IN_HANDLER_SUSPEND( Nuitka_GeneratorObject *generator, int yield_return_index, PyObject *target )
+{
+    return _YIELD_FROM_SUSPEND( generator, yield_return_index, target, true );
+}
+
+#endif
+
 #endif
 
 #endif
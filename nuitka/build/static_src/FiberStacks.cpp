@@ -0,0 +1,447 @@
+//     Copyright 2016, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+// Stacks for the fibers of the ucontext based implementations.
+//
+// The stacks are mapped memory with a guard page below them, so that a stack
+// overflow faults cleanly instead of corrupting other memory. Released stacks
+// are kept in a pool per thread, so creating generators in a loop does not
+// map and unmap memory all the time. Unless reused right away, the memory of
+// pooled stacks is given back to the OS, but their address space is kept.
+//
+// The stack size defaults to 1 MiB, can be set at compile time and overridden
+// by the environment variable "NUITKA_GENERATOR_STACK_SIZE" in KiB, but is not
+// smaller than 64 KiB. With adaptive stacks, the stack use of the first fibers
+// of a code object is measured, and later ones get a stack of a size that fits
+// it with plenty of room to spare.
+
+#include "nuitka/prelude.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef WITH_THREAD
+#include <pthread.h>
+#endif
+
+#if !defined( MAP_ANONYMOUS ) && defined( MAP_ANON )
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#ifndef MAP_STACK
+#define MAP_STACK 0
+#endif
+
+#ifndef _NUITKA_FIBER_STACK_SIZE
+#define _NUITKA_FIBER_STACK_SIZE (1024*1024)
+#endif
+
+// Smaller stacks do not even fit calls into the Python API, so configured
+// sizes are raised to this.
+#define FIBER_STACK_MINIMUM_SIZE (64*1024)
+
+// The maximum number of stacks kept per thread, can be overridden at compile
+// time, e.g. via CPPFLAGS.
+#ifndef _NUITKA_FIBER_STACK_POOL_LIMIT
+#define _NUITKA_FIBER_STACK_POOL_LIMIT 16
+#endif
+
+// The first stacks in the pool are kept as they are, these are the ones
+// reused in tight loops. For the others, the top of the stack, where shallow
+// generators run, is not given back to the OS, so reusing them does not page
+// fault all the time.
+#ifndef _NUITKA_FIBER_STACK_RESIDENT_COUNT
+#define _NUITKA_FIBER_STACK_RESIDENT_COUNT 2
+#endif
+
+#ifndef _NUITKA_FIBER_STACK_HOT_SIZE
+#define _NUITKA_FIBER_STACK_HOT_SIZE (64*1024)
+#endif
+
+struct FiberStackPool
+{
+    int count;
+
+    void *stacks[ _NUITKA_FIBER_STACK_POOL_LIMIT ];
+    size_t sizes[ _NUITKA_FIBER_STACK_POOL_LIMIT ];
+};
+
+static size_t page_size = 0;
+
+static size_t getGuardSize( void )
+{
+    if ( page_size == 0 )
+    {
+        page_size = (size_t)sysconf( _SC_PAGESIZE );
+    }
+
+    return page_size;
+}
+
+static size_t getDefaultFiberStackSize( void )
+{
+    static size_t result = 0;
+
+    if ( result == 0 )
+    {
+        result = _NUITKA_FIBER_STACK_SIZE;
+
+        char const *value = getenv( "NUITKA_GENERATOR_STACK_SIZE" );
+
+        if ( value != NULL )
+        {
+            long kib = atol( value );
+
+            if ( kib > 0 )
+            {
+                result = (size_t)kib * 1024;
+            }
+        }
+
+        if ( result < FIBER_STACK_MINIMUM_SIZE )
+        {
+            result = FIBER_STACK_MINIMUM_SIZE;
+        }
+
+        // Mapping is done in pages only, the guard is one.
+        size_t guard_size = getGuardSize();
+        result = ( result + guard_size - 1 ) / guard_size * guard_size;
+    }
+
+    return result;
+}
+
+static void unmapFiberStack( void *stack, size_t size )
+{
+    size_t guard_size = getGuardSize();
+
+    munmap( (char *)stack - guard_size, size + guard_size );
+}
+
+#ifdef WITH_THREAD
+static pthread_key_t pool_key;
+static pthread_once_t pool_key_once = PTHREAD_ONCE_INIT;
+
+// Called when a thread exits, unmap what its pool kept.
+static void destroyFiberStackPool( void *value )
+{
+    FiberStackPool *pool = (FiberStackPool *)value;
+
+    for( int i = 0; i < pool->count; i++ )
+    {
+        unmapFiberStack( pool->stacks[ i ], pool->sizes[ i ] );
+    }
+
+    free( pool );
+}
+
+static void createFiberStackPoolKey( void )
+{
+    pthread_key_create( &pool_key, destroyFiberStackPool );
+}
+
+static FiberStackPool *getFiberStackPool( void )
+{
+    pthread_once( &pool_key_once, createFiberStackPoolKey );
+
+    FiberStackPool *pool = (FiberStackPool *)pthread_getspecific( pool_key );
+
+    if (unlikely( pool == NULL ))
+    {
+        pool = (FiberStackPool *)malloc( sizeof( FiberStackPool ) );
+
+        if (unlikely( pool == NULL ))
+        {
+            return NULL;
+        }
+
+        pool->count = 0;
+        pthread_setspecific( pool_key, pool );
+    }
+
+    return pool;
+}
+#else
+static FiberStackPool fiber_stack_pool;
+
+static FiberStackPool *getFiberStackPool( void )
+{
+    return &fiber_stack_pool;
+}
+#endif
+
+static void *allocateStackMemory( size_t size )
+{
+    FiberStackPool *pool = getFiberStackPool();
+
+    // Most recently released stacks first, these are most likely still
+    // mapped in by the OS.
+    if (likely( pool != NULL ))
+    {
+        for( int i = pool->count - 1; i >= 0; i-- )
+        {
+            if ( pool->sizes[ i ] == size )
+            {
+                void *result = pool->stacks[ i ];
+
+                pool->count -= 1;
+                pool->stacks[ i ] = pool->stacks[ pool->count ];
+                pool->sizes[ i ] = pool->sizes[ pool->count ];
+
+                return result;
+            }
+        }
+    }
+
+    size_t guard_size = getGuardSize();
+
+    char *memory = (char *)mmap(
+        NULL,
+        size + guard_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK,
+        -1,
+        0
+    );
+
+    if (unlikely( memory == MAP_FAILED ))
+    {
+        return NULL;
+    }
+
+    // Stacks grow downwards on all supported targets, so the guard page is
+    // at the lowest address.
+    if (unlikely( mprotect( memory, guard_size, PROT_NONE ) != 0 ))
+    {
+        munmap( memory, size + guard_size );
+        return NULL;
+    }
+
+    return memory + guard_size;
+}
+
+static void releaseStackMemory( void *stack, size_t size )
+{
+
+    FiberStackPool *pool = getFiberStackPool();
+
+    if ( pool != NULL && pool->count < _NUITKA_FIBER_STACK_POOL_LIMIT )
+    {
+        // The content is not needed anymore, let the OS reclaim the memory
+        // until the stack is used again.
+        if ( pool->count >= _NUITKA_FIBER_STACK_RESIDENT_COUNT && size > _NUITKA_FIBER_STACK_HOT_SIZE )
+        {
+            madvise( stack, size - _NUITKA_FIBER_STACK_HOT_SIZE, MADV_DONTNEED );
+        }
+
+        pool->stacks[ pool->count ] = stack;
+        pool->sizes[ pool->count ] = size;
+        pool->count += 1;
+    }
+    else
+    {
+        unmapFiberStack( stack, size );
+    }
+}
+
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+
+// The number of fibers per code object, that get their stack use measured.
+#ifndef _NUITKA_FIBER_STACK_MEASURE_COUNT
+#define _NUITKA_FIBER_STACK_MEASURE_COUNT 4
+#endif
+
+// Adapted stacks are this much larger than the measured use, plus a margin,
+// as later fibers may take deeper paths, and a stack cannot grow.
+#define ADAPTED_STACK_FACTOR 4
+#define ADAPTED_STACK_MARGIN (64*1024)
+
+// Measured stacks are filled with this byte, the first changed word from the
+// bottom of the stack tells its use.
+#define STACK_CANARY_BYTE 0xa5
+
+struct FiberStackUsage
+{
+    void *key;
+
+    size_t high_water;
+    int measure_count;
+};
+
+// Hash table of stack use by code object, with open addressing. This is only
+// used while holding the GIL, so no locking is needed.
+static FiberStackUsage *stack_usages = NULL;
+static size_t stack_usages_size = 0;
+static size_t stack_usages_used = 0;
+
+static FiberStackUsage *lookupFiberStackUsage( FiberStackUsage *table, size_t table_size, void *key )
+{
+    size_t mask = table_size - 1;
+    size_t index = ( (uintptr_t)key >> 4 ) & mask;
+
+    while ( table[ index ].key != NULL && table[ index ].key != key )
+    {
+        index = ( index + 1 ) & mask;
+    }
+
+    return &table[ index ];
+}
+
+static FiberStackUsage *getFiberStackUsage( void *key )
+{
+    if ( stack_usages_used * 2 >= stack_usages_size )
+    {
+        size_t new_size = stack_usages_size ? stack_usages_size * 2 : 64;
+
+        FiberStackUsage *new_usages = (FiberStackUsage *)calloc( new_size, sizeof( FiberStackUsage ) );
+
+        if (unlikely( new_usages == NULL ))
+        {
+            return NULL;
+        }
+
+        for( size_t i = 0; i < stack_usages_size; i++ )
+        {
+            if ( stack_usages[ i ].key != NULL )
+            {
+                *lookupFiberStackUsage( new_usages, new_size, stack_usages[ i ].key ) = stack_usages[ i ];
+            }
+        }
+
+        free( stack_usages );
+
+        stack_usages = new_usages;
+        stack_usages_size = new_size;
+    }
+
+    FiberStackUsage *result = lookupFiberStackUsage( stack_usages, stack_usages_size, key );
+
+    if ( result->key == NULL )
+    {
+        result->key = key;
+        stack_usages_used += 1;
+    }
+
+    return result;
+}
+
+static size_t getAdaptedFiberStackSize( size_t high_water, size_t default_size )
+{
+    size_t needed = high_water * ADAPTED_STACK_FACTOR + ADAPTED_STACK_MARGIN;
+    size_t result = FIBER_STACK_MINIMUM_SIZE;
+
+    while ( result < needed && result < default_size )
+    {
+        result *= 2;
+    }
+
+    return result < default_size ? result : default_size;
+}
+
+static size_t measureFiberStackUse( void *stack, size_t size )
+{
+    uintptr_t canary;
+    memset( &canary, STACK_CANARY_BYTE, sizeof( canary ) );
+
+    uintptr_t *current = (uintptr_t *)stack;
+    uintptr_t *end = (uintptr_t *)( (char *)stack + size );
+
+    while ( current < end && *current == canary )
+    {
+        current++;
+    }
+
+    return (char *)end - (char *)current;
+}
+
+#endif
+
+bool acquireFiberStack( Fiber *to )
+{
+    size_t size = getDefaultFiberStackSize();
+
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+    to->stack_measured = false;
+
+    if ( to->stack_key != NULL )
+    {
+        FiberStackUsage *usage = getFiberStackUsage( to->stack_key );
+
+        if ( usage != NULL )
+        {
+            if ( usage->measure_count < _NUITKA_FIBER_STACK_MEASURE_COUNT )
+            {
+                to->stack_measured = true;
+            }
+            else
+            {
+                size = getAdaptedFiberStackSize( usage->high_water, size );
+            }
+        }
+    }
+#endif
+
+    void *stack = allocateStackMemory( size );
+
+    if (unlikely( stack == NULL ))
+    {
+        return false;
+    }
+
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+    if ( to->stack_measured )
+    {
+        memset( stack, STACK_CANARY_BYTE, size );
+    }
+#endif
+
+    to->start_stack = stack;
+    to->stack_size = size;
+
+    return true;
+}
+
+void releaseFiberStack( Fiber *to )
+{
+    assert( to->start_stack != NULL );
+
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+    if ( to->stack_measured )
+    {
+        FiberStackUsage *usage = getFiberStackUsage( to->stack_key );
+
+        if ( usage != NULL )
+        {
+            size_t used = measureFiberStackUse( to->start_stack, to->stack_size );
+
+            if ( used > usage->high_water )
+            {
+                usage->high_water = used;
+            }
+
+            usage->measure_count += 1;
+        }
+
+        to->stack_measured = false;
+    }
+#endif
+
+    releaseStackMemory( to->start_stack, to->stack_size );
+
+    to->start_stack = NULL;
+    to->stack_size = 0;
+}
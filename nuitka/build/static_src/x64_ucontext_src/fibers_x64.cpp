@@ -19,17 +19,16 @@
 
 #include "nuitka/prelude.hpp"
 
-#define STACK_SIZE (1024*1024)
-
-// Keep one stack around to avoid the overhead of repeated malloc/free in
-// case of frequent instantiations in a loop.
-static void *last_stack = NULL;
-
 void _initFiber( Fiber *to )
 {
     to->f_context.uc_stack.ss_sp = NULL;
     to->f_context.uc_link = NULL;
     to->start_stack = NULL;
+    to->stack_size = 0;
+#ifdef _NUITKA_ADAPTIVE_FIBER_STACKS
+    to->stack_key = NULL;
+    to->stack_measured = false;
+#endif
 }
 
 int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
@@ -45,11 +44,14 @@ int _prepareFiber( Fiber *to, void *code, uintptr_t arg )
         return 1;
     }
 
-    to->f_context.uc_stack.ss_size = STACK_SIZE;
-    to->f_context.uc_stack.ss_sp = last_stack ? last_stack : malloc( STACK_SIZE );
-    to->start_stack = to->f_context.uc_stack.ss_sp;
+    if (unlikely( !acquireFiberStack( to ) ))
+    {
+        return 1;
+    }
+
+    to->f_context.uc_stack.ss_size = to->stack_size;
+    to->f_context.uc_stack.ss_sp = to->start_stack;
     to->f_context.uc_link = NULL;
-    last_stack = NULL;
 
 #ifdef _NUITKA_MAKECONTEXT_INTS
     makecontext( &to->f_context, (void (*)())code, 2, ar[0], ar[1] );
@@ -63,15 +65,6 @@ void _releaseFiber( Fiber *to )
 {
     if ( to->start_stack != NULL )
     {
-        if ( last_stack == NULL )
-        {
-            last_stack = to->start_stack;
-        }
-        else
-        {
-            free( to->start_stack );
-        }
-
-        to->start_stack = NULL;
+        releaseFiberStack( to );
     }
 }
@@ -25,11 +25,20 @@ able to execute them without creating the argument dictionary at all.
 
 from .ConstantCodes import getConstantAccess
 from .ErrorCodes import getErrorExitCode, getReleaseCode, getReleaseCodes
-from .Helpers import generateChildExpressionCode, generateExpressionCode
+from .FunctionCodes import (
+    getDirectlyCalledModuleFunction,
+    getFunctionEntryPointIdentifier
+)
+from .Helpers import generateChildExpressionCode
+from .Indentation import indented
 from .LineNumberCodes import emitLineNumberUpdateCode
 from .templates.CodeTemplatesCalls import (
+    template_call_function_direct,
+    template_call_function_kwnames,
     template_call_function_with_args_decl,
     template_call_function_with_args_impl,
+    template_call_method_kwnames,
+    template_call_method_with_args,
     template_call_method_with_args_decl,
     template_call_method_with_args_impl
 )
@@ -39,8 +48,7 @@ from .templates.CodeTemplatesModules import (
 )
 
 
-def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_name,
-                             called_instance_name, emit, context):
+def _generateCallCodePosOnly(to_name, expression, called_name, emit, context):
     call_args = expression.getCallArgs()
 
     if call_args is None or call_args.isExpressionConstantRef():
@@ -55,6 +63,12 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
 
         assert type(call_args_value) is tuple
 
+        function_body = getDirectlyCalledModuleFunction(
+            called    = expression.getCalled(),
+            arg_count = len(call_args_value),
+            context   = context
+        )
+
         if call_args is not None and call_args.isMutable():
             call_arg_names = []
 
@@ -71,46 +85,35 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
                 call_arg_names.append(call_arg_name)
 
             getCallCodePosArgsQuick(
-                to_name     = to_name,
-                called_name = called_name,
-                arg_names   = call_arg_names,
-                needs_check = expression.mayRaiseException(BaseException),
-                emit        = emit,
-                context     = context
+                to_name       = to_name,
+                called_name   = called_name,
+                arg_names     = call_arg_names,
+                function_body = function_body,
+                needs_check   = expression.mayRaiseException(BaseException),
+                emit          = emit,
+                context       = context
             )
         elif call_args_value:
-            if called_name is not None:
-                getCallCodeFromTuple(
-                    to_name     = to_name,
-                    called_name = called_name,
-                    arg_tuple   = context.getConstantCode(
-                        constant = call_args_value
-                    ),
-                    arg_size    = len(call_args_value),
-                    needs_check = expression.mayRaiseException(BaseException),
-                    emit        = emit,
-                    context     = context
-                )
-            else:
-                getInstanceCallCodeFromTuple(
-                    to_name               = to_name,
-                    called_instance_name  = called_instance_name,
-                    called_attribute_name = called_attribute_name,
-                    arg_tuple             = context.getConstantCode(
-                        constant = call_args_value
-                    ),
-                    arg_size              = len(call_args_value),
-                    needs_check           = expression.mayRaiseException(BaseException),
-                    emit                  = emit,
-                    context               = context
-                )
+            getCallCodeFromTuple(
+                to_name       = to_name,
+                called_name   = called_name,
+                arg_tuple     = context.getConstantCode(
+                    constant = call_args_value
+                ),
+                arg_size      = len(call_args_value),
+                function_body = function_body,
+                needs_check   = expression.mayRaiseException(BaseException),
+                emit          = emit,
+                context       = context
+            )
         else:
             getCallCodeNoArgs(
-                to_name     = to_name,
-                called_name = called_name,
-                needs_check = expression.mayRaiseException(BaseException),
-                emit        = emit,
-                context     = context
+                to_name       = to_name,
+                called_name   = called_name,
+                function_body = function_body,
+                needs_check   = expression.mayRaiseException(BaseException),
+                emit          = emit,
+                context       = context
             )
     elif call_args.isExpressionMakeTuple():
         call_arg_names = []
@@ -130,12 +133,17 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
         )
 
         getCallCodePosArgsQuick(
-            to_name     = to_name,
-            called_name = called_name,
-            arg_names   = call_arg_names,
-            needs_check = expression.mayRaiseException(BaseException),
-            emit        = emit,
-            context     = context
+            to_name       = to_name,
+            called_name   = called_name,
+            arg_names     = call_arg_names,
+            function_body = getDirectlyCalledModuleFunction(
+                called    = expression.getCalled(),
+                arg_count = len(call_arg_names),
+                context   = context
+            ),
+            needs_check   = expression.mayRaiseException(BaseException),
+            emit          = emit,
+            context       = context
         )
     else:
         args_name = generateChildExpressionCode(
@@ -158,14 +166,8 @@ def _generateCallCodePosOnly(to_name, expression, called_name, called_attribute_
         )
 
 
-def _generateCallCodeKwOnly(to_name, expression, call_kw, called_name,
-                            called_attribute_name, called_instance_name, emit,
+def _generateCallCodeKwOnly(to_name, expression, call_kw, called_name, emit,
                             context):
-    # TODO: Not yet specialized for method calls.
-    assert called_name is not None
-    assert called_attribute_name is None
-    assert called_instance_name is None
-
     call_kw_name = generateChildExpressionCode(
         expression = call_kw,
         emit       = emit,
@@ -185,50 +187,352 @@ def _generateCallCodeKwOnly(to_name, expression, call_kw, called_name,
     )
 
 
-def generateCallCode(to_name, expression, emit, context):
-    # There is a whole lot of different cases, for each of which, we create
-    # optimized code, constant, with and without positional or keyword arguments
-    # each, so there is lots of branches involved.
+def _getKeywordNames(call_args, call_kw):
+    """ Names of the keyword arguments, if these are constant strings.
+
+        The values of these, and of the positional arguments, can then be
+        passed in an array, without creating a dictionary.
+    """
+
+    if call_args is not None and \
+       not call_args.isExpressionConstantRef() and \
+       not call_args.isExpressionMakeTuple():
+        return None
+
+    if call_kw.isExpressionConstantRef():
+        kw_names = tuple(call_kw.getConstant().keys())
+    elif call_kw.isExpressionMakeDict():
+        kw_names = []
+
+        for pair in call_kw.getPairs():
+            if not pair.getKey().isExpressionConstantRef():
+                return None
+
+            kw_names.append(pair.getKey().getConstant())
+
+        kw_names = tuple(kw_names)
+    else:
+        return None
+
+    for kw_name in kw_names:
+        if type(kw_name) is not str:
+            return None
+
+    # Later values of the same name would overwrite earlier ones.
+    if len(set(kw_names)) != len(kw_names):
+        return None
+
+    return kw_names
+
+
+def _getCallArgNames(call_args, emit, context):
+    """ Names of the positional argument values, one each.
+
+        The arguments must be absent, constant, or a tuple creation.
+    """
+
+    arg_names = []
+
+    if call_args is None:
+        pass
+    elif call_args.isExpressionConstantRef():
+        for call_arg_element in call_args.getConstant():
+            arg_name = context.allocateTempName("call_arg_element")
+
+            getConstantAccess(
+                to_name  = arg_name,
+                constant = call_arg_element,
+                emit     = emit,
+                context  = context,
+            )
+
+            arg_names.append(arg_name)
+    else:
+        for call_arg_element in call_args.getElements():
+            arg_names.append(
+                generateChildExpressionCode(
+                    child_name = call_args.getChildName() + "_element",
+                    expression = call_arg_element,
+                    emit       = emit,
+                    context    = context,
+                )
+            )
+
+    return arg_names
+
+
+def _getKeywordValueNames(call_kw, emit, context):
+    kw_names = []
+    value_names = []
+
+    if call_kw.isExpressionConstantRef():
+        for kw_name, kw_value in call_kw.getConstant().items():
+            kw_names.append(kw_name)
+
+            value_name = context.allocateTempName("call_arg_element")
+
+            getConstantAccess(
+                to_name  = value_name,
+                constant = kw_value,
+                emit     = emit,
+                context  = context,
+            )
+
+            value_names.append(value_name)
+    else:
+        # The keys are constants, only the values need to be evaluated, and
+        # that is done in order.
+        for pair in call_kw.getPairs():
+            kw_names.append(pair.getKey().getConstant())
+
+            value_names.append(
+                generateChildExpressionCode(
+                    child_name = call_kw.getChildName() + "_value",
+                    expression = pair.getValue(),
+                    emit       = emit,
+                    context    = context,
+                )
+            )
+
+    return tuple(kw_names), value_names
+
+
+def _generateCallCodeKwNames(to_name, expression, called_name, emit, context):
+    arg_names = _getCallArgNames(
+        call_args = expression.getCallArgs(),
+        emit      = emit,
+        context   = context
+    )
+
+    args_size = len(arg_names)
+
+    kw_names, value_names = _getKeywordValueNames(
+        call_kw = expression.getCallKw(),
+        emit    = emit,
+        context = context
+    )
+
+    arg_names += value_names
+
+    context.setCurrentSourceCodeReference(
+        expression.getCompatibleSourceReference()
+    )
+
+    emitLineNumberUpdateCode(emit, context)
+
+    emit(
+        template_call_function_kwnames % {
+            "to_name"     : to_name,
+            "called_name" : called_name,
+            "args"        : ", ".join(arg_names),
+            "args_count"  : args_size,
+            "kw_names"    : context.getConstantCode(
+                constant = kw_names
+            )
+        }
+    )
+
+    getReleaseCodes(
+        release_names = [called_name] + arg_names,
+        emit          = emit,
+        context       = context
+    )
+
+    getErrorExitCode(
+        check_name  = to_name,
+        needs_check = expression.mayRaiseException(BaseException),
+        emit        = emit,
+        context     = context
+    )
+
+    context.addCleanupTempName(to_name)
+
+
+def _isMethodCall(expression):
+    """ Is this a call of an attribute, that may avoid the bound method.
+
+        The attribute is looked up before the arguments are evaluated, so
+        only the argument forms that are passed in arrays qualify.
+    """
 
     called = expression.getCalled()
 
-    # TODO: Make this work for all cases.
-    if False and called.isExpressionAttributeLookup():
-        called_instance_name = context.allocateTempName("called_instance")
-        generateExpressionCode(
-            to_name    = called_instance_name,
-            expression = called.getLookupSource(),
-            emit       = emit,
-            context    = context
+    if not called.isExpressionAttributeLookup():
+        return False
+
+    # These have their own slot based lookups.
+    if called.getAttributeName() in ("__dict__", "__class__"):
+        return False
+
+    call_args = expression.getCallArgs()
+    call_kw = expression.getCallKw()
+
+    if call_kw is None or \
+       (call_kw.isExpressionConstantRef() and call_kw.getConstant() == {}):
+        return call_args is None or \
+               call_args.isExpressionConstantRef() or \
+               call_args.isExpressionMakeTuple()
+    else:
+        return _getKeywordNames(call_args, call_kw) is not None
+
+
+def _generateMethodCallCode(to_name, expression, emit, context):
+    called = expression.getCalled()
+    call_kw = expression.getCallKw()
+
+    source_name = generateChildExpressionCode(
+        expression = called.getLookupSource(),
+        emit       = emit,
+        context    = context
+    )
+
+    # The looked up function does not keep the object alive, so be sure to
+    # own a reference until the call is done.
+    if not context.needsCleanup(source_name):
+        emit("Py_INCREF( %s );" % source_name)
+        context.addCleanupTempName(source_name)
+
+    called_name = context.allocateTempName("called")
+    self_name = context.allocateTempName("called_self")
+
+    attribute_name = called.getAttributeName()
+
+    old_source_ref = context.setCurrentSourceCodeReference(
+        called.getSourceReference()
+    )
+
+    emit(
+        "%s = LOOKUP_METHOD( %s, %s, &%s );" % (
+            called_name,
+            source_name,
+            context.getConstantCode(
+                constant = attribute_name
+            ),
+            self_name
         )
+    )
+
+    getErrorExitCode(
+        check_name  = called_name,
+        needs_check = called.getLookupSource().mayRaiseExceptionAttributeLookup(
+            exception_type = BaseException,
+            attribute_name = attribute_name
+        ),
+        emit        = emit,
+        context     = context
+    )
+
+    context.addCleanupTempName(called_name)
+
+    context.setCurrentSourceCodeReference(old_source_ref)
+
+    arg_names = _getCallArgNames(
+        call_args = expression.getCallArgs(),
+        emit      = emit,
+        context   = context
+    )
 
-        called_attribute_name = context.getConstantCode(
-            constant = called.getAttributeName()
+    args_size = len(arg_names)
+
+    if call_kw is None or \
+       (call_kw.isExpressionConstantRef() and call_kw.getConstant() == {}):
+        kw_names = None
+    else:
+        kw_names, value_names = _getKeywordValueNames(
+            call_kw = call_kw,
+            emit    = emit,
+            context = context
         )
 
-        called_name = None
+        arg_names += value_names
+
+    context.setCurrentSourceCodeReference(
+        expression.getCompatibleSourceReference()
+    )
+
+    emitLineNumberUpdateCode(emit, context)
+
+    if kw_names is None:
+        quick_calls_used.add(args_size)
+        quick_instance_calls_used.add(args_size)
+
+        emit(
+            template_call_method_with_args % {
+                "to_name"         : to_name,
+                "called_name"     : called_name,
+                "self_name"       : self_name,
+                "args"            : ", ".join(arg_names) or "NULL",
+                "args_count"      : args_size,
+                "call_site_cache" : _getCallSiteCacheDeclaration(context)
+            }
+        )
     else:
-        called_instance_name = None
-        called_attribute_name = None
+        emit(
+            template_call_method_kwnames % {
+                "to_name"     : to_name,
+                "called_name" : called_name,
+                "self_name"   : self_name,
+                "args"        : ", ".join(arg_names),
+                "args_count"  : args_size,
+                "kw_names"    : context.getConstantCode(
+                    constant = kw_names
+                )
+            }
+        )
 
-        called_name = generateChildExpressionCode(
-            expression = called,
+    getReleaseCodes(
+        release_names = [called_name, source_name] + arg_names,
+        emit          = emit,
+        context       = context
+    )
+
+    getErrorExitCode(
+        check_name  = to_name,
+        needs_check = expression.mayRaiseException(BaseException),
+        emit        = emit,
+        context     = context
+    )
+
+    context.addCleanupTempName(to_name)
+
+
+def generateCallCode(to_name, expression, emit, context):
+    # There is a whole lot of different cases, for each of which, we create
+    # optimized code, constant, with and without positional or keyword arguments
+    # each, so there is lots of branches involved.
+
+    if _isMethodCall(expression):
+        return _generateMethodCallCode(
+            to_name    = to_name,
+            expression = expression,
             emit       = emit,
             context    = context
         )
 
+    called_name = generateChildExpressionCode(
+        expression = expression.getCalled(),
+        emit       = emit,
+        context    = context
+    )
+
     call_kw = expression.getCallKw()
 
     if call_kw is None or \
        (call_kw.isExpressionConstantRef() and call_kw.getConstant() == {}):
         _generateCallCodePosOnly(
-            to_name               = to_name,
-            called_name           = called_name,
-            called_attribute_name = called_attribute_name,
-            called_instance_name  = called_instance_name,
-            expression            = expression,
-            emit                  = emit,
-            context               = context
+            to_name     = to_name,
+            called_name = called_name,
+            expression  = expression,
+            emit        = emit,
+            context     = context
+        )
+    elif _getKeywordNames(expression.getCallArgs(), call_kw) is not None:
+        _generateCallCodeKwNames(
+            to_name     = to_name,
+            called_name = called_name,
+            expression  = expression,
+            emit        = emit,
+            context     = context
         )
     else:
         call_args = expression.getCallArgs()
@@ -237,14 +541,12 @@ def generateCallCode(to_name, expression, emit, context):
            (call_args.isExpressionConstantRef() and \
             call_args.getConstant() == ()):
             _generateCallCodeKwOnly(
-                to_name               = to_name,
-                called_name           = called_name,
-                called_attribute_name = called_attribute_name,
-                called_instance_name  = called_instance_name,
-                expression            = expression,
-                call_kw               = call_kw,
-                emit                  = emit,
-                context               = context
+                to_name     = to_name,
+                called_name = called_name,
+                expression  = expression,
+                call_kw     = call_kw,
+                emit        = emit,
+                context     = context
             )
         else:
             call_args_name = generateChildExpressionCode(
@@ -273,13 +575,46 @@ def generateCallCode(to_name, expression, emit, context):
             )
 
 
-def getCallCodeNoArgs(to_name, called_name, needs_check, emit, context):
+def _getCallCodeWithDirectPath(to_name, called_name, function_body, args,
+                               arg_size, generic_call):
+    # Without a function known to be possibly called, only the generic call.
+    if function_body is None:
+        return "%s = %s;" % (to_name, generic_call)
+
+    return template_call_function_direct % {
+        "to_name"                  : to_name,
+        "called_name"              : called_name,
+        "function_impl_identifier" : getFunctionEntryPointIdentifier(
+            function_identifier = function_body.getCodeName()
+        ),
+        "args"                     : args,
+        "args_count"               : arg_size,
+        "generic_call"             : generic_call
+    }
+
+
+def _getCallSiteCacheDeclaration(context):
+    # Each call site remembers how to call the objects seen there, named
+    # after the source for statistics output.
+    return """\
+static Nuitka_CallSiteCache call_site_cache = { "%s:%d" };""" % (
+        context.getModuleName(),
+        context.getCurrentSourceCodeReference().getLineNumber()
+    )
+
+
+def getCallCodeNoArgs(to_name, called_name, needs_check, emit, context,
+                      function_body = None):
     emitLineNumberUpdateCode(emit, context)
 
     emit(
-        "%s = CALL_FUNCTION_NO_ARGS( %s );" % (
-            to_name,
-            called_name
+        _getCallCodeWithDirectPath(
+            to_name       = to_name,
+            called_name   = called_name,
+            function_body = function_body,
+            args          = "NULL",
+            arg_size      = 0,
+            generic_call  = "CALL_FUNCTION_NO_ARGS( %s )" % called_name
         )
     )
 
@@ -305,7 +640,7 @@ quick_calls_used = set([1, 2, 3])
 quick_instance_calls_used = set()
 
 def getCallCodePosArgsQuick(to_name, called_name, arg_names, needs_check,
-                            emit, context):
+                            emit, context, function_body = None):
 
     arg_size = len(arg_names)
     quick_calls_used.add(arg_size)
@@ -319,13 +654,25 @@ def getCallCodePosArgsQuick(to_name, called_name, arg_names, needs_check,
         """\
 {
     PyObject *call_args[] = { %s };
-    %s = CALL_FUNCTION_WITH_ARGS%d( %s, call_args );
+%s
+%s
 }
 """ % (
             ", ".join(arg_names),
-            to_name,
-            arg_size,
-            called_name,
+            indented(_getCallSiteCacheDeclaration(context)),
+            indented(
+                _getCallCodeWithDirectPath(
+                    to_name       = to_name,
+                    called_name   = called_name,
+                    function_body = function_body,
+                    args          = "call_args",
+                    arg_size      = arg_size,
+                    generic_call  = "CALL_FUNCTION_WITH_ARGS%d_CACHED( %s, call_args, &call_site_cache )" % (
+                        arg_size,
+                        called_name
+                    )
+                )
+            )
         )
     )
 
@@ -345,47 +692,8 @@ def getCallCodePosArgsQuick(to_name, called_name, arg_names, needs_check,
     context.addCleanupTempName(to_name)
 
 
-def getInstanceCallCodeFromTuple(to_name, called_instance_name, called_attribute_name,
-                                 arg_tuple, arg_size, needs_check, emit, context):
-    quick_instance_calls_used.add(arg_size)
-
-    # For 0 arguments, NOARGS is supposed to be used.
-    assert arg_size > 0
-
-    emitLineNumberUpdateCode(emit, context)
-
-    emit(
-        """\
-%s = CALL_METHOD_WITH_ARGS%d( %s, %s, &PyTuple_GET_ITEM( %s, 0 ) );
-""" % (
-            to_name,
-            arg_size,
-            called_instance_name,
-            called_attribute_name,
-            arg_tuple,
-        )
-    )
-
-    getReleaseCodes(
-        release_names = (
-            called_instance_name,
-            called_attribute_name
-        ),
-        emit          = emit,
-        context       = context
-    )
-
-    getErrorExitCode(
-        check_name  = to_name,
-        needs_check = needs_check,
-        emit        = emit,
-        context     = context
-    )
-
-    context.addCleanupTempName(to_name)
-
 def getCallCodeFromTuple(to_name, called_name, arg_tuple, arg_size,
-                         needs_check, emit, context):
+                         function_body, needs_check, emit, context):
     quick_calls_used.add(arg_size)
 
     # For 0 arguments, NOARGS is supposed to be used.
@@ -393,14 +701,30 @@ def getCallCodeFromTuple(to_name, called_name, arg_tuple, arg_size,
 
     emitLineNumberUpdateCode(emit, context)
 
+    args = "&PyTuple_GET_ITEM( %s, 0 )" % arg_tuple
+
     emit(
         """\
-%s = CALL_FUNCTION_WITH_ARGS%d( %s, &PyTuple_GET_ITEM( %s, 0 ) );
+{
+%s
+%s
+}
 """ % (
-            to_name,
-            arg_size,
-            called_name,
-            arg_tuple,
+            indented(_getCallSiteCacheDeclaration(context)),
+            indented(
+                _getCallCodeWithDirectPath(
+                    to_name       = to_name,
+                    called_name   = called_name,
+                    function_body = function_body,
+                    args          = args,
+                    arg_size      = arg_size,
+                    generic_call  = "CALL_FUNCTION_WITH_ARGS%d_CACHED( %s, %s, &call_site_cache )" % (
+                        arg_size,
+                        called_name,
+                        args
+                    )
+                )
+            )
         )
     )
 
@@ -447,16 +771,38 @@ def getCallCodePosArgs(to_name, called_name, args_name, needs_check, emit, conte
     context.addCleanupTempName(to_name)
 
 
+def _isKeywordArgsGiven(call_kw_name, context):
+    """ Is the keyword arguments dictionary released right after the call.
+
+        Then compiled functions may use it for their star dict parameter, if
+        there are no other references to it. This is the case for temporary
+        values, and for the parameters of the complex call helpers, which
+        are the last thing these do.
+    """
+
+    return context.needsCleanup(call_kw_name) or \
+           context.getOwner().getParentModule().isInternalModule()
+
+
 def getCallCodeKeywordArgs(to_name, called_name, call_kw_name, emit, context):
     emitLineNumberUpdateCode(emit, context)
 
-    emit(
-        "%s = CALL_FUNCTION_WITH_KEYARGS( %s, %s );" % (
-            to_name,
-            called_name,
-            call_kw_name
+    if _isKeywordArgsGiven(call_kw_name, context):
+        emit(
+            "%s = CALL_FUNCTION_GIVING_KWARGS( %s, const_tuple_empty, %s );" % (
+                to_name,
+                called_name,
+                call_kw_name
+            )
+        )
+    else:
+        emit(
+            "%s = CALL_FUNCTION_WITH_KEYARGS( %s, %s );" % (
+                to_name,
+                called_name,
+                call_kw_name
+            )
         )
-    )
 
     getReleaseCodes(
         release_names = (called_name, call_kw_name),
@@ -478,8 +824,11 @@ def getCallCodePosKeywordArgs(to_name, called_name, call_args_name,
     emitLineNumberUpdateCode(emit, context)
 
     emit(
-        "%s = CALL_FUNCTION( %s, %s, %s );" % (
+        "%s = %s( %s, %s, %s );" % (
             to_name,
+            "CALL_FUNCTION_GIVING_KWARGS"
+              if _isKeywordArgsGiven(call_kw_name, context) else
+            "CALL_FUNCTION",
             called_name,
             call_args_name,
             call_kw_name
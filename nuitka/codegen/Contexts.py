@@ -298,6 +298,14 @@ class PythonChildContextBase(PythonContextBase):
     def addDeclaration(self, key, code):
         self.parent.addDeclaration(key, code)
 
+    def hasDeclaration(self, key):
+        return self.parent.hasDeclaration(key)
+
+    def getModuleFunctionDefinitions(self):
+        return self.parent.getModuleFunctionDefinitions()
+
+    def setModuleFunctionDefinitions(self, function_definitions):
+        self.parent.setModuleFunctionDefinitions(function_definitions)
 
 
 def _getConstantDefaultPopulation():
@@ -545,6 +553,8 @@ class PythonModuleContext(PythonContextBase, TempMixin, CodeObjectsMixin,
 
         self.needs_module_filename_object = False
 
+        self.function_definitions = None
+
     def __repr__(self):
         return "<PythonModuleContext instance for module %s>" % self.filename
 
@@ -604,6 +614,9 @@ class PythonModuleContext(PythonContextBase, TempMixin, CodeObjectsMixin,
 
         self.declaration_codes[ key ] = code
 
+    def hasDeclaration(self, key):
+        return key in self.declaration_codes
+
     def getDeclarations(self):
         return self.declaration_codes
 
@@ -652,6 +665,12 @@ class PythonModuleContext(PythonContextBase, TempMixin, CodeObjectsMixin,
     def needsModuleFilenameObject(self):
         return self.needs_module_filename_object
 
+    def getModuleFunctionDefinitions(self):
+        return self.function_definitions
+
+    def setModuleFunctionDefinitions(self, function_definitions):
+        self.function_definitions = function_definitions
+
 
 class PythonFunctionContext(PythonChildContextBase, TempMixin,
                             FrameDeclarationsMixin):
@@ -746,6 +765,24 @@ class PythonFunctionDirectContext(PythonFunctionContext):
         return False
 
 class PythonGeneratorObjectContext(PythonFunctionContext):
+    def __init__(self, parent, function):
+        PythonFunctionContext.__init__(
+            self,
+            parent   = parent,
+            function = function
+        )
+
+        # Resume points of stackless generators, one per yield.
+        self.yield_return_count = 0
+
+    def allocateYieldReturnIndex(self):
+        self.yield_return_count += 1
+
+        return self.yield_return_count
+
+    def getYieldReturnCount(self):
+        return self.yield_return_count
+
     def isForDirectCall(self):
         return False
 
@@ -870,6 +907,9 @@ class PythonStatementCContext(PythonChildContextBase):
     def allocateLabel(self, label):
         return self.parent.allocateLabel(label)
 
+    def allocateYieldReturnIndex(self):
+        return self.parent.allocateYieldReturnIndex()
+
     def addCleanupTempName(self, tmp_name):
         assert tmp_name not in self.cleanup_names, tmp_name
 
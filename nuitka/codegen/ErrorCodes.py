@@ -175,68 +175,102 @@ def getErrorFormatExitBoolCode(condition, exception, args, emit, context):
         }
     )
 
-def getErrorVariableDeclarations():
+def getDeclarationsFromInfos(variable_infos):
+    return tuple(
+        "%s%s%s%s;" % (
+            type_name,
+            ' ' if not type_name.endswith('*') else "",
+            variable_name,
+            " = %s" % init_value if init_value is not None else ""
+        )
+        for type_name, variable_name, init_value in
+        variable_infos
+    )
+
+
+def getErrorVariableInfos():
     return (
-        "PyObject *exception_type = NULL, *exception_value = NULL;",
-        "PyTracebackObject *exception_tb = NULL;",
-        "NUITKA_MAY_BE_UNUSED int exception_lineno = -1;"
+        ("PyObject *", "exception_type", "NULL"),
+        ("PyObject *", "exception_value", "NULL"),
+        ("PyTracebackObject *", "exception_tb", "NULL"),
+        ("NUITKA_MAY_BE_UNUSED int", "exception_lineno", "-1")
     )
 
-def getExceptionKeeperVariableNames(keeper_index):
+def getErrorVariableDeclarations():
+    return getDeclarationsFromInfos(getErrorVariableInfos())
+
+def getExceptionKeeperVariableInfos(keeper_index):
     # For finally handlers of Python3, which have conditions on assign and
     # use.
     debug = Options.isDebug() and python_version >= 300
 
     if debug:
-        keeper_obj_init = " = NULL"
+        keeper_obj_init = "NULL"
     else:
-        keeper_obj_init = ""
+        keeper_obj_init = None
 
     return (
-        "PyObject *exception_keeper_type_%d%s;" % (
-            keeper_index,
+        (
+            "PyObject *",
+            "exception_keeper_type_%d" % keeper_index,
             keeper_obj_init
         ),
-        "PyObject *exception_keeper_value_%d%s;" % (
-            keeper_index,
+        (
+            "PyObject *",
+            "exception_keeper_value_%d" % keeper_index,
             keeper_obj_init
         ),
-        "PyTracebackObject *exception_keeper_tb_%d%s;" % (
-            keeper_index,
+        (
+            "PyTracebackObject *",
+            "exception_keeper_tb_%d" % keeper_index,
             keeper_obj_init
         ),
-        "NUITKA_MAY_BE_UNUSED int exception_keeper_lineno_%d%s;" % (
-            keeper_index,
-            " = -1" if debug else ""
+        (
+            "NUITKA_MAY_BE_UNUSED int",
+            "exception_keeper_lineno_%d" % keeper_index,
+            "-1" if debug else None
         )
     )
 
+def getExceptionKeeperVariableNames(keeper_index):
+    return getDeclarationsFromInfos(
+        getExceptionKeeperVariableInfos(keeper_index)
+    )
 
-def getExceptionPreserverVariableNames(preserver_id):
+
+def getExceptionPreserverVariableInfos(preserver_id):
     # For finally handlers of Python3, which have conditions on assign and
     # use.
     debug = Options.isDebug() and python_version >= 300
 
     if debug:
-        preserver_obj_init = " = NULL"
+        preserver_obj_init = "NULL"
     else:
-        preserver_obj_init = ""
+        preserver_obj_init = None
 
     return (
-        "PyObject *exception_preserved_type_%d%s;" % (
-            preserver_id,
+        (
+            "PyObject *",
+            "exception_preserved_type_%d" % preserver_id,
             preserver_obj_init
         ),
-        "PyObject *exception_preserved_value_%d%s;" % (
-            preserver_id,
+        (
+            "PyObject *",
+            "exception_preserved_value_%d" % preserver_id,
             preserver_obj_init
         ),
-        "PyTracebackObject *exception_preserved_tb_%d%s;" % (
-            preserver_id,
+        (
+            "PyTracebackObject *",
+            "exception_preserved_tb_%d" % preserver_id,
             preserver_obj_init
         ),
     )
 
+def getExceptionPreserverVariableNames(preserver_id):
+    return getDeclarationsFromInfos(
+        getExceptionPreserverVariableInfos(preserver_id)
+    )
+
 
 def getErrorFormatExitCode(check_name, exception, args, emit, context):
     getErrorFormatExitBoolCode(
@@ -20,6 +20,7 @@
 """
 
 from nuitka.PythonVersions import python_version
+from nuitka.tree.Extractions import getNodesMatching
 
 from .ConstantCodes import getConstantCode
 from .CoroutineCodes import getCoroutineObjectDeclCode
@@ -42,11 +43,13 @@ from .templates.CodeTemplatesFunction import (
     function_dict_setup,
     function_direct_body_template,
     template_function_body,
-    template_function_closure_making,
+    template_function_closure_copying,
     template_function_direct_declaration,
     template_function_exception_exit,
+    template_function_impl_declaration,
     template_function_make_declaration,
     template_function_return_exit,
+    template_function_star_list_reuse,
     template_make_function_with_context_template,
     template_make_function_without_context_template
 )
@@ -120,10 +123,142 @@ def getFunctionEntryPointIdentifier(function_identifier):
     return "impl_" + function_identifier
 
 
+def _getModuleFunctionDefinitions(module, context):
+    """ Module variables assigned a function defined at module level.
+
+        Variables that get assigned more than one function definition are
+        mapped to None, these cannot tell which one is called. This is done
+        once per module, and kept in its context only.
+    """
+
+    result = context.getModuleFunctionDefinitions()
+
+    if result is None:
+        result = {}
+
+        for assignment in getNodesMatching(
+            module.getBody(),
+            lambda node: node.isStatementAssignmentVariable() and \
+                         node.getAssignSource().isExpressionFunctionCreation()
+        ):
+            variable = assignment.getTargetVariableRef().getVariable()
+
+            if variable in result:
+                result[variable] = None
+            else:
+                result[variable] = assignment.getAssignSource().\
+                                     getFunctionRef().getFunctionBody()
+
+        context.setModuleFunctionDefinitions(result)
+
+    return result
+
+
+def getDirectlyCalledModuleFunction(called, arg_count, context):
+    """ Function body defined at module level that a call may go to.
+
+        The called object is checked at run time to still be that function,
+        then its C code can be called directly with the positional arguments,
+        which it must take exactly.
+    """
+
+    if not called.isExpressionVariableRef():
+        return None
+
+    variable = called.getVariable()
+
+    if not variable.isModuleVariable():
+        return None
+
+    module = variable.getOwner()
+
+    if module.getBody() is None or \
+       module is not context.getOwner().getParentModule():
+        return None
+
+    function_body = _getModuleFunctionDefinitions(module, context).get(variable)
+
+    if function_body is None:
+        return None
+
+    # The C code of created functions only, which takes the function object.
+    if not function_body.needsCreation() or function_body.needsDirectCall():
+        return None
+
+    if function_body.getClosureVariables():
+        return None
+
+    parameters = function_body.getParameters()
+
+    if parameters.getStarListArgumentName() is not None or \
+       parameters.getStarDictArgumentName() is not None or \
+       parameters.getKwOnlyParameterCount() != 0 or \
+       parameters.getArgumentCount() != arg_count:
+        return None
+
+    function_identifier = function_body.getCodeName()
+    impl_identifier = getFunctionEntryPointIdentifier(function_identifier)
+
+    # The function may be defined after the code calling it.
+    if not context.hasDeclaration(impl_identifier):
+        context.addDeclaration(
+            impl_identifier,
+            template_function_impl_declaration % {
+                "function_identifier" : function_identifier
+            }
+        )
+
+    return function_body
+
+
+def _isStarListArgumentPassedOn(function_body):
+    """ Is the star list argument only passed on as arguments of calls.
+
+        Then the function cannot tell it from a copy, and may be given the
+        argument tuple of its call as it is. Otherwise it could compare it
+        to that, and CPython always gives a new tuple.
+    """
+
+    variable = function_body.getParameters().getListStarArgVariable()
+
+    if variable is None or variable.isSharedTechnically() or \
+       function_body.needsLocalsDict():
+        return False
+
+    # This exposes the value without a reference to the variable, also for
+    # "vars", "exec" and "eval" without arguments.
+    if getNodesMatching(
+        function_body,
+        lambda node: node.isExpressionBuiltinLocals()
+    ):
+        return False
+
+    for variable_ref in getNodesMatching(
+        function_body,
+        lambda node: node.isExpressionVariableRef() and \
+                     node.getVariable() is variable
+    ):
+        parent = variable_ref.getParent()
+
+        if parent.isExpressionCall() or parent.isExpressionCallNoKeywords():
+            if variable_ref is not parent.getCallArgs():
+                return False
+        elif parent.isExpressionFunctionCall():
+            called_body = parent.getFunction().getFunctionRef().getFunctionBody()
+
+            if not called_body.getParentModule().isInternalModule() or \
+               not called_body.getFunctionName().startswith("complex_call_helper_"):
+                return False
+        else:
+            return False
+
+    return True
+
+
 def getFunctionMakerCode(function_name, function_qualname, function_identifier,
                          code_identifier, closure_variables, defaults_name,
                          kw_defaults_name, annotations_name, function_doc,
-                         context):
+                         star_list_reuse, context):
     # We really need this many parameters here and functions have many details,
     # that we express as variables, pylint: disable=R0914
     function_creation_args = _getFunctionCreationArgs(
@@ -141,6 +276,11 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
             context  = context
         )
 
+    if star_list_reuse:
+        function_setup = template_function_star_list_reuse
+    else:
+        function_setup = ""
+
     if closure_variables:
         closure_copy = []
 
@@ -158,7 +298,7 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
                 "Py_INCREF( closure[%d] );" %count
             )
 
-        closure_making = template_function_closure_making % {
+        closure_making = template_function_closure_copying % {
             "closure_copy"  : indented(closure_copy),
             "closure_count" : len(closure_variables)
         }
@@ -195,6 +335,7 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
             "module_identifier"          : getModuleAccessCode(
                 context = context
             ),
+            "function_setup"             : function_setup,
         }
     else:
         result = template_make_function_without_context_template % {
@@ -227,6 +368,7 @@ def getFunctionMakerCode(function_name, function_qualname, function_identifier,
             "module_identifier"          : getModuleAccessCode(
                 context = context
             ),
+            "function_setup"             : function_setup,
         }
 
     return result
@@ -321,6 +463,7 @@ def generateFunctionCreationCode(to_name, expression, emit, context):
             kw_defaults_name    = kw_defaults_name,
             annotations_name    = annotations_name,
             function_doc        = function_body.getDoc(),
+            star_list_reuse     = _isStarListArgumentPassedOn(function_body),
             context             = context
         )
 
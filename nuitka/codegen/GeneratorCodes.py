@@ -19,31 +19,32 @@
 
 """
 
+from nuitka import Options
 from nuitka.PythonVersions import python_version
 
 from .ConstantCodes import getConstantCode
 from .ErrorCodes import (
-    getErrorVariableDeclarations,
-    getExceptionKeeperVariableNames,
-    getExceptionPreserverVariableNames
+    getDeclarationsFromInfos,
+    getErrorVariableInfos,
+    getExceptionKeeperVariableInfos,
+    getExceptionPreserverVariableInfos
 )
 from .Indentation import indented
 from .LineNumberCodes import getErrorLineNumberUpdateCode
 from .templates.CodeTemplatesFrames import template_generator_initial_throw
-from .templates.CodeTemplatesFunction import (
-    function_dict_setup,
-    template_function_closure_making
-)
+from .templates.CodeTemplatesFunction import template_function_closure_making
 from .templates.CodeTemplatesGeneratorFunction import (
     template_generator_exception_exit,
     template_generator_making_with_context,
     template_generator_making_without_context,
     template_generator_noexception_exit,
     template_generator_return_exit,
+    template_generator_yield_dispatch,
     template_genfunc_yielder_body_template,
+    template_genfunc_yielder_body_template_stackless,
     template_genfunc_yielder_decl_template
 )
-from .VariableCodes import getLocalVariableInitCode, getVariableCode
+from .VariableCodes import getLocalVariableDeclaration, getVariableCode
 
 
 def getGeneratorObjectDeclCode(function_identifier):
@@ -51,52 +52,122 @@ def getGeneratorObjectDeclCode(function_identifier):
         "function_identifier" : function_identifier,
     }
 
-def getGeneratorObjectCode(context, function_identifier, user_variables,
-                           temp_variables, function_codes, needs_exception_exit,
-                           needs_generator_return):
-    function_locals = []
+def _getGeneratorLocalInfos(context, user_variables, temp_variables):
+    variable_infos = []
 
     for user_variable in user_variables + temp_variables:
-        function_locals.append(
-            getLocalVariableInitCode(
+        variable_infos.append(
+            getLocalVariableDeclaration(
                 variable = user_variable,
             )
         )
 
     if context.hasLocalsDict():
-        function_locals += function_dict_setup.split('\n')
+        variable_infos.append(
+            ("PyObject *", "locals_dict", "PyDict_New()")
+        )
 
     if context.needsExceptionVariables():
-        function_locals.extend(getErrorVariableDeclarations())
+        variable_infos.extend(getErrorVariableInfos())
 
     for keeper_index in range(1, context.getKeeperVariableCount()+1):
-        function_locals.extend(getExceptionKeeperVariableNames(keeper_index))
+        variable_infos.extend(getExceptionKeeperVariableInfos(keeper_index))
 
     for preserver_id in context.getExceptionPreserverCounts():
-        function_locals.extend(getExceptionPreserverVariableNames(preserver_id))
+        variable_infos.extend(getExceptionPreserverVariableInfos(preserver_id))
 
-    function_locals += [
-        "%s%s%s;" % (
-            tmp_type,
-            ' ' if not tmp_type.endswith('*') else "",
-            tmp_name
+    for tmp_name, tmp_type in context.getTempNameInfos():
+        # TODO: Could avoid this unless try/except or try/finally with returns
+        # occur.
+        if tmp_name == "tmp_generator_return":
+            init_value = "false"
+        elif tmp_name == "tmp_return_value" or \
+             tmp_name.startswith("tmp_outline_return_value_"):
+            init_value = "NULL"
+        else:
+            init_value = None
+
+        variable_infos.append(
+            (tmp_type, tmp_name, init_value)
         )
-        for tmp_name, tmp_type in
-        context.getTempNameInfos()
-    ]
 
-    function_locals += context.getFrameDeclarations()
+    return variable_infos
 
-    # TODO: Could avoid this unless try/except or try/finally with returns
-    # occur.
-    if context.hasTempName("generator_return"):
-        function_locals.append("tmp_generator_return = false;")
-    if context.hasTempName("return_value"):
-        function_locals.append("tmp_return_value = NULL;")
-    for tmp_name, tmp_type in context.getTempNameInfos():
-        if tmp_name.startswith("tmp_outline_return_value_"):
-            function_locals.append("%s = NULL;" % tmp_name)
 
+def _getStacklessGeneratorObjectCode(context, function_identifier,
+                                     variable_infos, function_codes,
+                                     generator_exit):
+    # The local variables are members of a heap storage structure, and the
+    # body code accesses them through references of the same name.
+    function_heap_decls = []
+    function_var_decls = []
+    function_var_inits = []
+
+    for type_name, variable_name, init_value in variable_infos:
+        function_heap_decls.append(
+            "%s%s%s;" % (
+                type_name.replace("NUITKA_MAY_BE_UNUSED ", ""),
+                ' ' if not type_name.endswith('*') else "",
+                variable_name
+            )
+        )
+
+        function_var_decls.append(
+            "%s%s&%s = generator_heap->%s;" % (
+                type_name,
+                ' ' if not type_name.endswith('*') else "",
+                variable_name,
+                variable_name
+            )
+        )
+
+        if init_value is not None:
+            function_var_inits.append(
+                "%s = %s;" % (
+                    variable_name,
+                    init_value
+                )
+            )
+
+    function_var_decls += context.getFrameDeclarations()
+
+    yield_return_count = context.getYieldReturnCount()
+
+    if yield_return_count:
+        yield_dispatch = template_generator_yield_dispatch % {
+            "yield_return_cases" : indented(
+                [
+                    "case %d: goto yield_return_%d;" % (
+                        yield_return_index,
+                        yield_return_index
+                    )
+                    for yield_return_index in
+                    range(1, yield_return_count+1)
+                ]
+            )
+        }
+    else:
+        yield_dispatch = ""
+
+    return template_genfunc_yielder_body_template_stackless % {
+        "function_identifier" : function_identifier,
+        "function_heap_decls" : indented(function_heap_decls),
+        "function_var_decls"  : indented(function_var_decls),
+        "yield_dispatch"      : yield_dispatch,
+        "function_body"       : indented(function_codes),
+        "function_var_inits"  : indented(function_var_inits),
+        "generator_exit"      : generator_exit
+    }
+
+
+def getGeneratorObjectCode(context, function_identifier, user_variables,
+                           temp_variables, function_codes, needs_exception_exit,
+                           needs_generator_return):
+    variable_infos = _getGeneratorLocalInfos(
+        context        = context,
+        user_variables = user_variables,
+        temp_variables = temp_variables
+    )
 
     if needs_exception_exit:
         generator_exit = template_generator_exception_exit % {}
@@ -106,6 +177,18 @@ def getGeneratorObjectCode(context, function_identifier, user_variables,
     if needs_generator_return:
         generator_exit += template_generator_return_exit % {}
 
+    if Options.isStacklessGenerators():
+        return _getStacklessGeneratorObjectCode(
+            context             = context,
+            function_identifier = function_identifier,
+            variable_infos      = variable_infos,
+            function_codes      = function_codes,
+            generator_exit      = generator_exit
+        )
+
+    function_locals = list(getDeclarationsFromInfos(variable_infos))
+    function_locals += context.getFrameDeclarations()
+
     return template_genfunc_yielder_body_template % {
         "function_identifier" : function_identifier,
         "function_body"       : indented(function_codes),
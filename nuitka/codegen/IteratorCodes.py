@@ -20,6 +20,7 @@
 Next variants and unpacking with related checks.
 """
 
+from nuitka import Options
 from nuitka.PythonVersions import python_version
 
 from .ErrorCodes import (
@@ -68,10 +69,16 @@ def generateBuiltinNext1Code(to_name, expression, emit, context):
 
 
 def getBuiltinLoopBreakNextCode(to_name, value, emit, context):
+    # Compiled generators may give values to loops in batches.
+    if Options.getGeneratorBatchSize() is not None:
+        next_helper = "ITERATOR_NEXT_BATCHED"
+    else:
+        next_helper = "ITERATOR_NEXT"
+
     emit(
         "%s = %s;" % (
             to_name,
-            "ITERATOR_NEXT( %s )" % value,
+            "%s( %s )" % (next_helper, value),
         )
     )
 
@@ -207,7 +207,7 @@ def getLocalVariableObjectAccessCode(context, variable):
         return code
 
 
-def getLocalVariableInitCode(variable, init_from = None):
+def getLocalVariableDeclaration(variable, init_from = None):
     assert not variable.isModuleVariable()
 
     if variable.isSharedTechnically():
@@ -233,6 +233,15 @@ def getLocalVariableInitCode(variable, init_from = None):
 
         init_value = "%s" % init_from
 
+    return type_name, code_name, init_value
+
+
+def getLocalVariableInitCode(variable, init_from = None):
+    type_name, code_name, init_value = getLocalVariableDeclaration(
+        variable  = variable,
+        init_from = init_from
+    )
+
     return "%s%s = %s;" % (
         type_name,
         code_name,
@@ -20,8 +20,51 @@
 The normal "yield", and the Python 3.3 or higher "yield from" variant.
 """
 
+from nuitka import Options
+from nuitka.tree.Extractions import getNodesMatching
+from nuitka.VariableRegistry import isSharedAmongScopes
+
 from .ErrorCodes import getErrorExitCode, getReleaseCode
 from .Helpers import generateChildExpressionsCode
+from .Indentation import indented
+from .LabelCodes import getLabelCode
+from .templates.CodeTemplatesGeneratorFunction import template_yield_batched
+
+
+def _isYieldAheadUnnoticed(generator_body):
+    """ Can the generator run ahead of its consumer without it being noticed.
+
+        Yielding ahead runs the code after a yield before the consumer uses
+        the value. That is only allowed, if nothing in the generator has side
+        effects, or can raise, or can see a change of the consumer, e.g. of
+        variables shared with other scopes.
+    """
+
+    def isUnnoticed(node):
+        if node.isExpressionYield():
+            return node.parent.isStatementExpressionOnly()
+        elif node.isExpression():
+            if node.isExpressionVariableRef():
+                variable = node.getVariable()
+
+                if variable.isModuleVariable() or \
+                   (not variable.isTempVariable() and \
+                    isSharedAmongScopes(variable)):
+                    return False
+
+            return not node.mayRaiseException(BaseException) and \
+                   not node.mayHaveSideEffects()
+        else:
+            return node.isStatementsSequence() or \
+                   node.isStatementsFrame() or \
+                   node.isStatementGeneratorEntry() or \
+                   node.isStatementExpressionOnly() or \
+                   node.isStatementLoop()
+
+    return not getNodesMatching(
+        generator_body.getBody(),
+        lambda node: not isUnnoticed(node)
+    )
 
 
 def generateYieldCode(to_name, expression, emit, context):
@@ -34,15 +77,70 @@ def generateYieldCode(to_name, expression, emit, context):
     # In handlers, we must preserve/restore the exception.
     preserve_exception = expression.isExceptionPreserving()
 
-    emit(
-        "%s = %s( generator, %s );" % (
-            to_name,
-            "YIELD" if not preserve_exception else "YIELD_IN_HANDLER",
-            value_name
-              if context.needsCleanup(value_name) else
-            "INCREASE_REFCOUNT( %s )" % value_name
+    yield_helper = "YIELD" if not preserve_exception else "YIELD_IN_HANDLER"
+
+    # When the value is not used, the yield may be done ahead of a compiled
+    # loop, without switching back to it, if that cannot be noticed.
+    batched = Options.getGeneratorBatchSize() is not None and \
+              not preserve_exception and \
+              expression.parent.isStatementExpressionOnly() and \
+              context.getOwner().isExpressionGeneratorObjectBody() and \
+              _isYieldAheadUnnoticed(context.getOwner())
+
+    if batched:
+        if not context.needsCleanup(value_name):
+            emit("Py_INCREF( %s );" % value_name)
+
+        yielded_value = value_name
+    else:
+        yielded_value = value_name \
+                          if context.needsCleanup(value_name) else \
+                        "INCREASE_REFCOUNT( %s )" % value_name
+
+    yield_codes = []
+
+    if Options.isStacklessGenerators():
+        # Leave the generator body, and resume after the return label when
+        # being called again.
+        yield_return_index = context.allocateYieldReturnIndex()
+
+        yield_codes.append(
+            "%s_SUSPEND( generator, %d, %s );" % (
+                yield_helper,
+                yield_return_index,
+                yielded_value
+            )
+        )
+        yield_codes.append("return;")
+
+        getLabelCode("yield_return_%d" % yield_return_index, yield_codes.append)
+
+        yield_codes.append(
+            "%s = %s_RESUME( generator );" % (
+                to_name,
+                yield_helper
+            )
+        )
+    else:
+        yield_codes.append(
+            "%s = %s( generator, %s );" % (
+                to_name,
+                yield_helper,
+                yielded_value
+            )
         )
-    )
+
+    if batched:
+        emit(
+            template_yield_batched % {
+                "to_name"     : to_name,
+                "value_name"  : value_name,
+                "yield_codes" : indented(yield_codes)
+            }
+        )
+    else:
+        for yield_code in yield_codes:
+            emit(yield_code)
 
     if context.needsCleanup(value_name):
         context.removeCleanupTempName(value_name)
@@ -67,15 +165,43 @@ def generateYieldFromCode(to_name, expression, emit, context):
     # In handlers, we must preserve/restore the exception.
     preserve_exception = expression.isExceptionPreserving()
 
-    emit(
-        "%s = %s( generator, %s );" % (
-            to_name,
-            "YIELD_FROM" if not preserve_exception else "YIELD_FROM_IN_HANDLER",
-            value_name
-              if context.needsCleanup(value_name) else
-            "INCREASE_REFCOUNT( %s )" % value_name
+    yield_helper = "YIELD_FROM" \
+                     if not preserve_exception else \
+                   "YIELD_FROM_IN_HANDLER"
+
+    target_value = value_name \
+                     if context.needsCleanup(value_name) else \
+                   "INCREASE_REFCOUNT( %s )" % value_name
+
+    if Options.isStacklessGenerators():
+        # The sub-generator is driven by the generator object, and the body
+        # is only left, if it doesn't finish immediately.
+        yield_return_index = context.allocateYieldReturnIndex()
+
+        emit(
+            "if ( %s_SUSPEND( generator, %d, %s ) )" % (
+                yield_helper,
+                yield_return_index,
+                target_value
+            )
+        )
+        emit("{")
+        emit("    return;")
+        emit("}")
+
+        getLabelCode("yield_return_%d" % yield_return_index, emit)
+
+        emit(
+            "%s = YIELD_FROM_RESUME( generator );" % to_name
+        )
+    else:
+        emit(
+            "%s = %s( generator, %s );" % (
+                to_name,
+                yield_helper,
+                target_value
+            )
         )
-    )
 
     if not context.needsCleanup(value_name):
         context.addCleanupTempName(value_name)
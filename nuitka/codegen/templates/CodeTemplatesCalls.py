@@ -19,23 +19,113 @@
 
 """
 
+template_call_function_direct = """\
+if ( Nuitka_Function_Check( %(called_name)s ) && ((Nuitka_FunctionObject *)%(called_name)s)->m_c_code == %(function_impl_identifier)s )
+{
+    %(to_name)s = CALL_FUNCTION_DIRECT( (Nuitka_FunctionObject *)%(called_name)s, %(args)s, %(args_count)d );
+}
+else
+{
+    %(to_name)s = %(generic_call)s;
+}"""
+
+template_call_function_kwnames = """\
+{
+    PyObject *call_args[] = { %(args)s };
+    static Nuitka_KeywordIndexes call_site_kw_indexes = { NULL, NULL };
+    %(to_name)s = CALL_FUNCTION_WITH_KWNAMES( %(called_name)s, call_args, %(args_count)d, %(kw_names)s, &call_site_kw_indexes );
+}
+"""
+
+template_call_method_with_args = """\
+{
+    PyObject *call_args[] = { %(args)s };
+    %(call_site_cache)s
+    %(to_name)s = CALL_METHOD_WITH_ARGS%(args_count)d( %(called_name)s, %(self_name)s, call_args, &call_site_cache );
+}
+"""
+
+template_call_method_kwnames = """\
+{
+    PyObject *call_args[] = { %(args)s };
+    static Nuitka_KeywordIndexes call_site_kw_indexes = { NULL, NULL };
+    %(to_name)s = CALL_METHOD_WITH_KWNAMES( %(called_name)s, %(self_name)s, call_args, %(args_count)d, %(kw_names)s, &call_site_kw_indexes );
+}
+"""
+
 template_call_function_with_args_decl = """\
-extern PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **args );"""
+extern PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **args );
+extern PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d_CACHED( PyObject *called, PyObject **args, Nuitka_CallSiteCache *cache );"""
 
 template_call_function_with_args_impl = """\
-PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **args )
+NUITKA_FORCE_INLINE static inline PyObject *_CALL_METHOD_FUNCTION_WITH_ARGS%(args_count)d( Nuitka_FunctionObject *function, PyObject *object, PyObject **args, Nuitka_CallStrategy strategy )
 {
-    CHECK_OBJECT( called );
+    if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+    {
+        return NULL;
+    }
 
-    // Check if arguments are valid objects in debug mode.
-#ifndef __NUITKA_NO_ASSERT__
-    for( size_t i = 0; i < %(args_count)d; i++ )
+    PyObject *result;
+
+    if ( strategy == NUITKA_CALL_METHOD_SIMPLE )
     {
-        CHECK_OBJECT( args[ i ] );
+#ifdef _MSC_VER
+        PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
+#else
+        PyObject *python_pars[ function->m_args_positional_count ];
+#endif
+        python_pars[ 0 ] = object;
+        Py_INCREF( object );
+
+        for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
+        {
+            python_pars[ i + 1 ] = args[ i ];
+            Py_INCREF( args[ i ] );
+        }
+
+        result = function->m_c_code( function, python_pars );
     }
+    else if ( strategy == NUITKA_CALL_METHOD_DEFAULTS )
+    {
+#ifdef _MSC_VER
+        PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
+#else
+        PyObject *python_pars[ function->m_args_positional_count ];
 #endif
+        python_pars[ 0 ] = object;
+        memcpy( python_pars+1, args, %(args_count)d * sizeof(PyObject *) );
 
-    if ( Nuitka_Function_Check( called ) )
+        FILL_DEFAULTED_PARAMETERS( function, python_pars, %(args_count)d + 1 );
+
+        result = function->m_c_code( function, python_pars );
+    }
+    else
+    {
+#ifdef _MSC_VER
+        PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
+#else
+        PyObject *python_pars[ function->m_args_overall_count ];
+#endif
+        memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
+
+        if ( parseArgumentsMethodPos( function, python_pars, object, args, %(args_count)d ) )
+        {
+            result = function->m_c_code( function, python_pars );
+        }
+        else
+        {
+            result = NULL;
+        }
+    }
+
+    Py_LeaveRecursiveCall();
+
+    return result;
+}
+
+NUITKA_FORCE_INLINE static inline PyObject *_CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **args, Nuitka_CallStrategy strategy )
+{
+    if ( strategy <= NUITKA_CALL_FUNCTION_PARSE )
     {
         if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
         {
@@ -45,7 +135,7 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
         Nuitka_FunctionObject *function = (Nuitka_FunctionObject *)called;
         PyObject *result;
 
-        if ( function->m_args_simple && %(args_count)d == function->m_args_positional_count )
+        if ( strategy == NUITKA_CALL_FUNCTION_SIMPLE )
         {
             for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
             {
@@ -54,7 +144,7 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
 
             result = function->m_c_code( function, args );
         }
-        else if ( function->m_args_simple && %(args_count)d + function->m_defaults_given == function->m_args_positional_count )
+        else if ( strategy == NUITKA_CALL_FUNCTION_DEFAULTS )
         {
 #ifdef _MSC_VER
             PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
@@ -62,12 +152,8 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
             PyObject *python_pars[ function->m_args_positional_count ];
 #endif
             memcpy( python_pars, args, %(args_count)d * sizeof(PyObject *) );
-            memcpy( python_pars + %(args_count)d, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
 
-            for( Py_ssize_t i = 0; i < function->m_args_positional_count; i++ )
-            {
-                Py_INCREF( python_pars[ i ] );
-            }
+            FILL_DEFAULTED_PARAMETERS( function, python_pars, %(args_count)d );
 
             result = function->m_c_code( function, python_pars );
         }
@@ -94,252 +180,176 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
 
         return result;
     }
-    else if ( Nuitka_Method_Check( called ) )
+    else if ( strategy <= NUITKA_CALL_METHOD_PARSE )
     {
         Nuitka_MethodObject *method = (Nuitka_MethodObject *)called;
 
-        // Unbound method without arguments, let the error path be slow.
-        if ( method->m_object != NULL )
-        {
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
-
-            Nuitka_FunctionObject *function = method->m_function;
-
-            PyObject *result;
-
-            if ( function->m_args_simple && %(args_count)d + 1 == function->m_args_positional_count )
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-                PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-                python_pars[ 0 ] = method->m_object;
-                Py_INCREF( method->m_object );
-
-                for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
-                {
-                    python_pars[ i + 1 ] = args[ i ];
-                    Py_INCREF( args[ i ] );
-                }
-
-                result = function->m_c_code( function, python_pars );
-            }
-            else if ( function->m_args_simple && %(args_count)d + 1 + function->m_defaults_given == function->m_args_positional_count )
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-                PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-                python_pars[ 0 ] = method->m_object;
-                Py_INCREF( method->m_object );
-
-                memcpy( python_pars+1, args, %(args_count)d * sizeof(PyObject *) );
-                memcpy( python_pars+1 + %(args_count)d, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
-
-                for( Py_ssize_t i = 1; i < function->m_args_overall_count; i++ )
-                {
-                    Py_INCREF( python_pars[ i ] );
-                }
-
-                result = function->m_c_code( function, python_pars );
-            }
-            else
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-                PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-                memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-                if ( parseArgumentsMethodPos( function, python_pars, method->m_object, args, %(args_count)d ) )
-                {
-                    result = function->m_c_code( function, python_pars );
-                }
-                else
-                {
-                    result = NULL;
-                }
-            }
-
-            Py_LeaveRecursiveCall();
-
-            return result;
-        }
+        return _CALL_METHOD_FUNCTION_WITH_ARGS%(args_count)d( method->m_function, method->m_object, args, strategy );
     }
-    else if ( PyCFunction_Check( called ) )
+    else if ( strategy == NUITKA_CALL_CFUNCTION_NOARGS )
     {
-        // Try to be fast about wrapping the arguments.
-        int flags = PyCFunction_GET_FLAGS( called );
-
-        if ( flags & METH_NOARGS )
-        {
 #if %(args_count)d == 0
-            PyCFunction method = PyCFunction_GET_FUNCTION( called );
-            PyObject *self = PyCFunction_GET_SELF( called );
+        PyCFunction method = PyCFunction_GET_FUNCTION( called );
+        PyObject *self = PyCFunction_GET_SELF( called );
 
-            // Recursion guard is not strictly necessary, as we already have
-            // one on our way to here.
+        // Recursion guard is not strictly necessary, as we already have
+        // one on our way to here.
 #ifdef _NUITKA_FULL_COMPAT
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
 #endif
 
-            PyObject *result = (*method)( self, NULL );
+        PyObject *result = (*method)( self, NULL );
 
 #ifdef _NUITKA_FULL_COMPAT
-            Py_LeaveRecursiveCall();
+        Py_LeaveRecursiveCall();
 #endif
 
-            if ( result != NULL )
-            {
-            // Some buggy C functions do set an error, but do not indicate it
-            // and Nuitka inner workings can get upset/confused from it.
-                DROP_ERROR_OCCURRED();
+        if ( result != NULL )
+        {
+        // Some buggy C functions do set an error, but do not indicate it
+        // and Nuitka inner workings can get upset/confused from it.
+            DROP_ERROR_OCCURRED();
 
-                return result;
-            }
-            else
+            return result;
+        }
+        else
+        {
+            // Other buggy C functions do this, return NULL, but with
+            // no error set, not allowed.
+            if (unlikely( !ERROR_OCCURRED() ))
             {
-                // Other buggy C functions do this, return NULL, but with
-                // no error set, not allowed.
-                if (unlikely( !ERROR_OCCURRED() ))
-                {
-                    PyErr_Format(
-                        PyExc_SystemError,
-                        "NULL result without error in PyObject_Call"
-                    );
-                }
-
-                return NULL;
+                PyErr_Format(
+                    PyExc_SystemError,
+                    "NULL result without error in PyObject_Call"
+                );
             }
-#else
-            PyErr_Format(
-                PyExc_TypeError,
-                "%%s() takes no arguments (%(args_count)d given)",
-                ((PyCFunctionObject *)called)->m_ml->ml_name
-            );
+
             return NULL;
-#endif
         }
-        else if ( flags & METH_O )
-        {
+#else
+        PyErr_Format(
+            PyExc_TypeError,
+            "%%s() takes no arguments (%(args_count)d given)",
+            ((PyCFunctionObject *)called)->m_ml->ml_name
+        );
+        return NULL;
+#endif
+    }
+    else if ( strategy == NUITKA_CALL_CFUNCTION_O )
+    {
 #if %(args_count)d == 1
-            PyCFunction method = PyCFunction_GET_FUNCTION( called );
-            PyObject *self = PyCFunction_GET_SELF( called );
+        PyCFunction method = PyCFunction_GET_FUNCTION( called );
+        PyObject *self = PyCFunction_GET_SELF( called );
 
-            // Recursion guard is not strictly necessary, as we already have
-            // one on our way to here.
+        // Recursion guard is not strictly necessary, as we already have
+        // one on our way to here.
 #ifdef _NUITKA_FULL_COMPAT
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
 #endif
 
-            PyObject *result = (*method)( self, args[0] );
+        PyObject *result = (*method)( self, args[0] );
 
 #ifdef _NUITKA_FULL_COMPAT
-            Py_LeaveRecursiveCall();
+        Py_LeaveRecursiveCall();
 #endif
 
-            if ( result != NULL )
-            {
-            // Some buggy C functions do set an error, but do not indicate it
-            // and Nuitka inner workings can get upset/confused from it.
-                DROP_ERROR_OCCURRED();
+        if ( result != NULL )
+        {
+        // Some buggy C functions do set an error, but do not indicate it
+        // and Nuitka inner workings can get upset/confused from it.
+            DROP_ERROR_OCCURRED();
 
-                return result;
-            }
-            else
+            return result;
+        }
+        else
+        {
+            // Other buggy C functions do this, return NULL, but with
+            // no error set, not allowed.
+            if (unlikely( !ERROR_OCCURRED() ))
             {
-                // Other buggy C functions do this, return NULL, but with
-                // no error set, not allowed.
-                if (unlikely( !ERROR_OCCURRED() ))
-                {
-                    PyErr_Format(
-                        PyExc_SystemError,
-                        "NULL result without error in PyObject_Call"
-                    );
-                }
-
-                return NULL;
+                PyErr_Format(
+                    PyExc_SystemError,
+                    "NULL result without error in PyObject_Call"
+                );
             }
-#else
-            PyErr_Format(PyExc_TypeError,
-                "%%s() takes exactly one argument (%(args_count)d given)",
-                 ((PyCFunctionObject *)called)->m_ml->ml_name
-            );
+
             return NULL;
-#endif
         }
-        else
-        {
-            PyCFunction method = PyCFunction_GET_FUNCTION( called );
-            PyObject *self = PyCFunction_GET_SELF( called );
+#else
+        PyErr_Format(PyExc_TypeError,
+            "%%s() takes exactly one argument (%(args_count)d given)",
+             ((PyCFunctionObject *)called)->m_ml->ml_name
+        );
+        return NULL;
+#endif
+    }
+    else if ( strategy == NUITKA_CALL_CFUNCTION_VARARGS )
+    {
+        int flags = PyCFunction_GET_FLAGS( called );
 
-            PyObject *pos_args = MAKE_TUPLE( args, %(args_count)d );
+        PyCFunction method = PyCFunction_GET_FUNCTION( called );
+        PyObject *self = PyCFunction_GET_SELF( called );
 
-            PyObject *result;
+        PyObject *pos_args = MAKE_TUPLE( args, %(args_count)d );
 
-            assert( flags && METH_VARARGS );
+        PyObject *result;
+
+        assert( flags & METH_VARARGS );
 
-            // Recursion guard is not strictly necessary, as we already have
-            // one on our way to here.
+        // Recursion guard is not strictly necessary, as we already have
+        // one on our way to here.
 #ifdef _NUITKA_FULL_COMPAT
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
+        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
+        {
+            return NULL;
+        }
 #endif
 
-            if ( flags && METH_KEYWORDS )
-            {
-                result = (*(PyCFunctionWithKeywords)method)( self, pos_args, NULL );
-            }
-            else
-            {
-                result = (*method)( self, pos_args );
-            }
+        if ( flags & METH_KEYWORDS )
+        {
+            result = (*(PyCFunctionWithKeywords)method)( self, pos_args, NULL );
+        }
+        else
+        {
+            result = (*method)( self, pos_args );
+        }
 
 #ifdef _NUITKA_FULL_COMPAT
-            Py_LeaveRecursiveCall();
+        Py_LeaveRecursiveCall();
 #endif
 
-            if ( result != NULL )
-            {
-            // Some buggy C functions do set an error, but do not indicate it
-            // and Nuitka inner workings can get upset/confused from it.
-                DROP_ERROR_OCCURRED();
+        if ( result != NULL )
+        {
+        // Some buggy C functions do set an error, but do not indicate it
+        // and Nuitka inner workings can get upset/confused from it.
+            DROP_ERROR_OCCURRED();
 
-                Py_DECREF( pos_args );
-                return result;
-            }
-            else
+            Py_DECREF( pos_args );
+            return result;
+        }
+        else
+        {
+            // Other buggy C functions do this, return NULL, but with
+            // no error set, not allowed.
+            if (unlikely( !ERROR_OCCURRED() ))
             {
-                // Other buggy C functions do this, return NULL, but with
-                // no error set, not allowed.
-                if (unlikely( !ERROR_OCCURRED() ))
-                {
-                    PyErr_Format(
-                        PyExc_SystemError,
-                        "NULL result without error in PyObject_Call"
-                    );
-                }
-
-                Py_DECREF( pos_args );
-                return NULL;
+                PyErr_Format(
+                    PyExc_SystemError,
+                    "NULL result without error in PyObject_Call"
+                );
             }
+
+            Py_DECREF( pos_args );
+            return NULL;
         }
     }
-    else if ( PyFunction_Check( called ) )
+    else if ( strategy == NUITKA_CALL_PYTHON_FUNCTION )
     {
         return callPythonFunction(
             called,
@@ -347,110 +357,76 @@ PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **ar
             %(args_count)d
         );
     }
+    else
+    {
+        PyObject *pos_args = MAKE_TUPLE( args, %(args_count)d );
 
-    PyObject *pos_args = MAKE_TUPLE( args, %(args_count)d );
-
-    PyObject *result = CALL_FUNCTION(
-        called,
-        pos_args,
-        NULL
-    );
+        PyObject *result = CALL_FUNCTION(
+            called,
+            pos_args,
+            NULL
+        );
 
-    Py_DECREF( pos_args );
+        Py_DECREF( pos_args );
 
-    return result;
+        return result;
+    }
 }
-"""
 
-
-template_call_method_with_args_decl = """\
-extern PyObject *CALL_METHOD_WITH_ARGS%(args_count)d( PyObject *called_instance, PyObject *attribute_name, PyObject **args );\
-"""
-
-template_call_method_with_args_impl = """\
-PyObject *CALL_METHOD_WITH_ARGS%(args_count)d( PyObject *source, PyObject *attr_name, PyObject **args )
+PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d( PyObject *called, PyObject **args )
 {
-    PyObject *called;
+    CHECK_OBJECT( called );
 
-#if PYTHON_VERSION < 300
-    if ( PyInstance_Check( source ) )
+    // Check if arguments are valid objects in debug mode.
+#ifndef __NUITKA_NO_ASSERT__
+    for( size_t i = 0; i < %(args_count)d; i++ )
     {
-        PyInstanceObject *source_instance = (PyInstanceObject *)source;
-
-        called = GET_STRING_DICT_VALUE( (PyDictObject *)source_instance->in_dict, (PyStringObject *)attr_name );
-
-        if ( called )
-        {
-            // Unlikely a method now.
-            Py_INCREF( called );
-        }
-        else
-        {
-            // Next see if a class has it
-            PyObject *attribute = FIND_ATTRIBUTE_IN_CLASS( source_instance->in_class, attr_name );
+        CHECK_OBJECT( args[ i ] );
+    }
+#endif
 
-            if ( attribute )
-            {
-                descrgetfunc descr_get = Py_TYPE( attribute )->tp_descr_get;
+    return _CALL_FUNCTION_WITH_ARGS%(args_count)d(
+        called,
+        args,
+        GET_CALL_STRATEGY( called, %(args_count)d )
+    );
+}
 
-                if ( descr_get == Nuitka_Function_Type.tp_descr_get )
-                {
-                    Nuitka_FunctionObject *function = (Nuitka_FunctionObject *)attribute;
+PyObject *CALL_FUNCTION_WITH_ARGS%(args_count)d_CACHED( PyObject *called, PyObject **args, Nuitka_CallSiteCache *cache )
+{
+    CHECK_OBJECT( called );
 
-                    if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-                    {
-                        return NULL;
-                    }
-#ifdef _MSC_VER
-                    PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-                    PyObject *python_pars[ function->m_args_overall_count ];
+    // Check if arguments are valid objects in debug mode.
+#ifndef __NUITKA_NO_ASSERT__
+    for( size_t i = 0; i < %(args_count)d; i++ )
+    {
+        CHECK_OBJECT( args[ i ] );
+    }
 #endif
-                    memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-                    PyObject *result;
 
-                    if ( parseArgumentsMethodPos( function, python_pars, source, args, %(args_count)d ) )
-                    {
-                        result = function->m_c_code( function, python_pars );
-                    }
-                    else
-                    {
-                        result = NULL;
-                    }
-
-                    Py_LeaveRecursiveCall();
+    return _CALL_FUNCTION_WITH_ARGS%(args_count)d(
+        called,
+        args,
+        LOOKUP_CALL_STRATEGY( cache, called, %(args_count)d )
+    );
+}
+"""
 
-                    return result;
-                }
-                else
-                {
-                    called = descr_get( attribute, source, (PyObject *)source_instance->in_class );
 
-                    if (unlikely( called == NULL ))
-                    {
-                        return NULL;
-                    }
-                }
+template_call_method_with_args_decl = """\
+extern PyObject *CALL_METHOD_WITH_ARGS%(args_count)d( PyObject *called, PyObject *self, PyObject **args, Nuitka_CallSiteCache *cache );"""
 
-            }
-            else
-            {
-                if (unlikely( !CHECK_AND_CLEAR_ATTRIBUTE_ERROR_OCCURRED() ))
-                {
-                    return NULL;
-                }
-            }
-        }
-    }
-    else
-#endif
+template_call_method_with_args_impl = """\
+PyObject *CALL_METHOD_WITH_ARGS%(args_count)d( PyObject *called, PyObject *self, PyObject **args, Nuitka_CallSiteCache *cache )
+{
+    // Not looked up as a method, this is a normal call of the value.
+    if ( self == NULL )
     {
-        called = LOOKUP_ATTRIBUTE( source, attr_name );
+        return CALL_FUNCTION_WITH_ARGS%(args_count)d_CACHED( called, args, cache );
     }
 
-    if (unlikely( called == NULL )) return NULL;
     CHECK_OBJECT( called );
+    CHECK_OBJECT( self );
 
     // Check if arguments are valid objects in debug mode.
 #ifndef __NUITKA_NO_ASSERT__
@@ -462,328 +438,43 @@ PyObject *CALL_METHOD_WITH_ARGS%(args_count)d( PyObject *source, PyObject *attr_
 
     if ( Nuitka_Function_Check( called ) )
     {
-        if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-        {
-            return NULL;
-        }
-
         Nuitka_FunctionObject *function = (Nuitka_FunctionObject *)called;
-        PyObject *result;
+        Nuitka_CallStrategy strategy;
 
-        if ( function->m_args_simple && %(args_count)d == function->m_args_positional_count )
+        if ( function->m_args_simple && %(args_count)d + 1 == function->m_args_positional_count )
         {
-            for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
-            {
-                Py_INCREF( args[ i ] );
-            }
-
-            result = function->m_c_code( function, args );
+            strategy = NUITKA_CALL_METHOD_SIMPLE;
         }
-        else if ( function->m_args_simple && %(args_count)d + function->m_defaults_given == function->m_args_positional_count )
+        else if ( function->m_args_simple && %(args_count)d + 1 >= function->m_args_required_count && %(args_count)d + 1 < function->m_args_positional_count )
         {
-#ifdef _MSC_VER
-            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-            PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-            memcpy( python_pars, args, %(args_count)d * sizeof(PyObject *) );
-            memcpy( python_pars + %(args_count)d, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
-
-            for( Py_ssize_t i = 0; i < function->m_args_positional_count; i++ )
-            {
-                Py_INCREF( python_pars[ i ] );
-            }
-
-            result = function->m_c_code( function, python_pars );
+            strategy = NUITKA_CALL_METHOD_DEFAULTS;
         }
         else
         {
-#ifdef _MSC_VER
-            PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-            PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-            memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-            if ( parseArgumentsPos( function, python_pars, args, %(args_count)d ))
-            {
-                result = function->m_c_code( function, python_pars );
-            }
-            else
-            {
-                result = NULL;
-            }
+            strategy = NUITKA_CALL_METHOD_PARSE;
         }
 
-        Py_LeaveRecursiveCall();
-
-        return result;
+        return _CALL_METHOD_FUNCTION_WITH_ARGS%(args_count)d( function, self, args, strategy );
     }
-    else if ( Nuitka_Method_Check( called ) )
+    else if ( Nuitka_MethodDescr_Check( called ) )
     {
-        Nuitka_MethodObject *method = (Nuitka_MethodObject *)called;
-
-        // Unbound method without arguments, let the error path be slow.
-        if ( method->m_object != NULL )
-        {
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
-
-            Nuitka_FunctionObject *function = method->m_function;
-
-            PyObject *result;
-
-            if ( function->m_args_simple && %(args_count)d + 1 == function->m_args_positional_count )
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-                PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-                python_pars[ 0 ] = method->m_object;
-                Py_INCREF( method->m_object );
-
-                for( Py_ssize_t i = 0; i < %(args_count)d; i++ )
-                {
-                    python_pars[ i + 1 ] = args[ i ];
-                    Py_INCREF( args[ i ] );
-                }
-
-                result = function->m_c_code( function, python_pars );
-            }
-            else if ( function->m_args_simple && %(args_count)d + 1 + function->m_defaults_given == function->m_args_positional_count )
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_positional_count );
-#else
-                PyObject *python_pars[ function->m_args_positional_count ];
-#endif
-                python_pars[ 0 ] = method->m_object;
-                Py_INCREF( method->m_object );
-
-                memcpy( python_pars+1, args, %(args_count)d * sizeof(PyObject *) );
-                memcpy( python_pars+1 + %(args_count)d, &PyTuple_GET_ITEM( function->m_defaults, 0 ), function->m_defaults_given * sizeof(PyObject *) );
-
-                for( Py_ssize_t i = 1; i < function->m_args_overall_count; i++ )
-                {
-                    Py_INCREF( python_pars[ i ] );
-                }
-
-                result = function->m_c_code( function, python_pars );
-            }
-            else
-            {
-#ifdef _MSC_VER
-                PyObject **python_pars = (PyObject **)_alloca( sizeof( PyObject * ) * function->m_args_overall_count );
-#else
-                PyObject *python_pars[ function->m_args_overall_count ];
-#endif
-                memset( python_pars, 0, function->m_args_overall_count * sizeof(PyObject *) );
-
-                if ( parseArgumentsMethodPos( function, python_pars, method->m_object, args, %(args_count)d ) )
-                {
-                    result = function->m_c_code( function, python_pars );
-                }
-                else
-                {
-                    result = NULL;
-                }
-            }
-
-            Py_LeaveRecursiveCall();
-
-            return result;
-        }
+        return CALL_METHODDESCR_WITH_ARGS( called, self, args, %(args_count)d );
     }
-    else if ( PyCFunction_Check( called ) )
-    {
-        // Try to be fast about wrapping the arguments.
-        int flags = PyCFunction_GET_FLAGS( called );
-
-        if ( flags & METH_NOARGS )
-        {
-#if %(args_count)d == 0
-            PyCFunction method = PyCFunction_GET_FUNCTION( called );
-            PyObject *self = PyCFunction_GET_SELF( called );
-
-            // Recursion guard is not strictly necessary, as we already have
-            // one on our way to here.
-#ifdef _NUITKA_FULL_COMPAT
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
-#endif
-
-            PyObject *result = (*method)( self, NULL );
-
-#ifdef _NUITKA_FULL_COMPAT
-            Py_LeaveRecursiveCall();
-#endif
-
-            if ( result != NULL )
-            {
-            // Some buggy C functions do set an error, but do not indicate it
-            // and Nuitka inner workings can get upset/confused from it.
-                DROP_ERROR_OCCURRED();
-
-                return result;
-            }
-            else
-            {
-                // Other buggy C functions do this, return NULL, but with
-                // no error set, not allowed.
-                if (unlikely( !ERROR_OCCURRED() ))
-                {
-                    PyErr_Format(
-                        PyExc_SystemError,
-                        "NULL result without error in PyObject_Call"
-                    );
-                }
-
-                return NULL;
-            }
-#else
-            PyErr_Format(
-                PyExc_TypeError,
-                "%%s() takes no arguments (%(args_count)d given)",
-                ((PyCFunctionObject *)called)->m_ml->ml_name
-            );
-            return NULL;
-#endif
-        }
-        else if ( flags & METH_O )
-        {
-#if %(args_count)d == 1
-            PyCFunction method = PyCFunction_GET_FUNCTION( called );
-            PyObject *self = PyCFunction_GET_SELF( called );
-
-            // Recursion guard is not strictly necessary, as we already have
-            // one on our way to here.
-#ifdef _NUITKA_FULL_COMPAT
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
-#endif
-
-            PyObject *result = (*method)( self, args[0] );
-
-#ifdef _NUITKA_FULL_COMPAT
-            Py_LeaveRecursiveCall();
-#endif
 
-            if ( result != NULL )
-            {
-            // Some buggy C functions do set an error, but do not indicate it
-            // and Nuitka inner workings can get upset/confused from it.
-                DROP_ERROR_OCCURRED();
+    // Only uncompiled functions are left, these get the object as their first
+    // argument too.
+    assert( PyFunction_Check( called ) );
 
-                return result;
-            }
-            else
-            {
-                // Other buggy C functions do this, return NULL, but with
-                // no error set, not allowed.
-                if (unlikely( !ERROR_OCCURRED() ))
-                {
-                    PyErr_Format(
-                        PyExc_SystemError,
-                        "NULL result without error in PyObject_Call"
-                    );
-                }
-
-                return NULL;
-            }
-#else
-            PyErr_Format(PyExc_TypeError,
-                "%%s() takes exactly one argument (%(args_count)d given)",
-                 ((PyCFunctionObject *)called)->m_ml->ml_name
-            );
-            return NULL;
-#endif
-        }
-        else
-        {
-            PyCFunction method = PyCFunction_GET_FUNCTION( called );
-            PyObject *self = PyCFunction_GET_SELF( called );
+    PyObject *method_args[ %(args_count)d + 1 ];
 
-            PyObject *pos_args = MAKE_TUPLE( args, %(args_count)d );
+    method_args[ 0 ] = self;
+    memcpy( method_args + 1, args, %(args_count)d * sizeof(PyObject *) );
 
-            PyObject *result;
-
-            assert( flags && METH_VARARGS );
-
-            // Recursion guard is not strictly necessary, as we already have
-            // one on our way to here.
-#ifdef _NUITKA_FULL_COMPAT
-            if (unlikely( Py_EnterRecursiveCall( (char *)" while calling a Python object" ) ))
-            {
-                return NULL;
-            }
-#endif
-
-            if ( flags && METH_KEYWORDS )
-            {
-                result = (*(PyCFunctionWithKeywords)method)( self, pos_args, NULL );
-            }
-            else
-            {
-                result = (*method)( self, pos_args );
-            }
-
-#ifdef _NUITKA_FULL_COMPAT
-            Py_LeaveRecursiveCall();
-#endif
-
-            if ( result != NULL )
-            {
-            // Some buggy C functions do set an error, but do not indicate it
-            // and Nuitka inner workings can get upset/confused from it.
-                DROP_ERROR_OCCURRED();
-
-                Py_DECREF( pos_args );
-                return result;
-            }
-            else
-            {
-                // Other buggy C functions do this, return NULL, but with
-                // no error set, not allowed.
-                if (unlikely( !ERROR_OCCURRED() ))
-                {
-                    PyErr_Format(
-                        PyExc_SystemError,
-                        "NULL result without error in PyObject_Call"
-                    );
-                }
-
-                Py_DECREF( pos_args );
-                return NULL;
-            }
-        }
-    }
-    else if ( PyFunction_Check( called ) )
-    {
-        return callPythonFunction(
-            called,
-            args,
-            %(args_count)d
-        );
-    }
-
-    PyObject *pos_args = MAKE_TUPLE( args, %(args_count)d );
-
-    PyObject *result = CALL_FUNCTION(
+    return callPythonFunction(
         called,
-        pos_args,
-        NULL
+        method_args,
+        %(args_count)d + 1
     );
-
-    Py_DECREF( pos_args );
-
-    return result;
 }
 """
 
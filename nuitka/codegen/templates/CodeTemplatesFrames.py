@@ -20,7 +20,7 @@
 """
 
 template_frame_guard_cache_decl = """\
-static PyFrameObject *cache_%(frame_identifier)s = NULL;
+static Nuitka_FrameCache cache_%(frame_identifier)s;
 """
 
 template_frame_guard_frame_decl = """\
@@ -29,8 +29,7 @@ PyFrameObject *%(frame_identifier)s;
 
 # Frame in a function
 template_frame_guard_full_block = """\
-MAKE_OR_REUSE_FRAME( cache_%(frame_identifier)s, %(code_identifier)s, %(module_identifier)s );
-%(frame_identifier)s = cache_%(frame_identifier)s;
+%(frame_identifier)s = MAKE_OR_REUSE_FRAME( &cache_%(frame_identifier)s, %(code_identifier)s, %(module_identifier)s );
 
 // Push the new frame as the currently active one.
 pushFrameStack( %(frame_identifier)s );
@@ -98,12 +97,14 @@ RESTORE_FRAME_EXCEPTION( %(frame_identifier)s );
     {
 %(store_frame_locals)s
 
-        detachFrame( exception_tb, %(frame_locals_name)s );
+        popDetachedFrame( &cache_%(frame_identifier)s, exception_tb, %(frame_locals_name)s );
+    }
+    else
+    {
+        popFrameStack();
     }
 }
 
-popFrameStack();
-
 #if PYTHON_VERSION >= 340
 %(frame_identifier)s->f_executing -= 1;
 #endif
@@ -200,8 +201,7 @@ if ( generator->m_exception_type )
 
 # Frame in a generator
 template_frame_guard_generator = """\
-MAKE_OR_REUSE_FRAME( %(frame_cache_identifier)s, %(code_identifier)s, %(module_identifier)s );
-generator->m_frame = %(frame_cache_identifier)s;
+generator->m_frame = MAKE_OR_REUSE_FRAME( &%(frame_cache_identifier)s, %(code_identifier)s, %(module_identifier)s );
 Py_INCREF( generator->m_frame );
 
 #if PYTHON_VERSION >= 340
@@ -223,16 +223,17 @@ generator->m_frame->f_executing += 1;
 #if PYTHON_VERSION >= 300
 // Accept currently existing exception as the one to publish again when we
 // yield or yield from.
-
-PyThreadState *thread_state = PyThreadState_GET();
-
-generator->m_frame->f_exc_type = thread_state->exc_type;
-if ( generator->m_frame->f_exc_type == Py_None ) generator->m_frame->f_exc_type = NULL;
-Py_XINCREF( generator->m_frame->f_exc_type );
-generator->m_frame->f_exc_value = thread_state->exc_value;
-Py_XINCREF( generator->m_frame->f_exc_value );
-generator->m_frame->f_exc_traceback = thread_state->exc_traceback;
-Py_XINCREF( generator->m_frame->f_exc_traceback );
+{
+    PyThreadState *thread_state = PyThreadState_GET();
+
+    generator->m_frame->f_exc_type = thread_state->exc_type;
+    if ( generator->m_frame->f_exc_type == Py_None ) generator->m_frame->f_exc_type = NULL;
+    Py_XINCREF( generator->m_frame->f_exc_type );
+    generator->m_frame->f_exc_value = thread_state->exc_value;
+    Py_XINCREF( generator->m_frame->f_exc_value );
+    generator->m_frame->f_exc_traceback = thread_state->exc_traceback;
+    Py_XINCREF( generator->m_frame->f_exc_traceback );
+}
 #endif
 
 // Framed code:
@@ -254,8 +255,7 @@ goto %(no_exception_exit)s;
 
 # Frame in a coroutine
 template_frame_guard_coroutine = """\
-MAKE_OR_REUSE_FRAME( %(frame_cache_identifier)s, %(code_identifier)s, %(module_identifier)s );
-coroutine->m_frame = %(frame_cache_identifier)s;
+coroutine->m_frame = MAKE_OR_REUSE_FRAME( &%(frame_cache_identifier)s, %(code_identifier)s, %(module_identifier)s );
 Py_INCREF( coroutine->m_frame );
 
 coroutine->m_frame->f_gen = (PyObject *)coroutine;
@@ -23,6 +23,10 @@ template_function_make_declaration = """\
 static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_arg_spec)s );
 """
 
+template_function_impl_declaration = """\
+static PyObject *impl_%(function_identifier)s( Nuitka_FunctionObject const *self, PyObject **python_pars );
+"""
+
 template_function_direct_declaration = """\
 %(file_scope)s PyObject *impl_%(function_identifier)s( %(direct_call_arg_spec)s );
 """
@@ -32,6 +36,12 @@ template_function_closure_making = """\
 %(closure_copy)s
 """
 
+# Functions copy the closure into their own object, so the array can be local.
+template_function_closure_copying = """\
+    PyCellObject *closure[%(closure_count)d];
+%(closure_copy)s
+"""
+
 template_make_function_with_context_template = """
 static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_args)s )
 {
@@ -55,7 +65,7 @@ static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_args
         closure,
         %(closure_count)d
     );
-
+%(function_setup)s
     return result;
 }
 """
@@ -78,11 +88,15 @@ static PyObject *MAKE_FUNCTION_%(function_identifier)s( %(function_creation_args
         %(module_identifier)s,
         %(function_doc)s
     );
-
+%(function_setup)s
     return result;
 }
 """
 
+template_function_star_list_reuse = """\
+    ((Nuitka_FunctionObject *)result)->m_args_star_list_reuse = true;
+"""
+
 template_function_body = """\
 static PyObject *impl_%(function_identifier)s( %(parameter_objects_decl)s )
 {
@@ -39,10 +39,57 @@ static void %(function_identifier)s_context( Nuitka_GeneratorObject *generator )
 }
 """
 
-template_generator_exception_exit = """\
-    RESTORE_ERROR_OCCURRED( PyExc_StopIteration, NULL, NULL );
-    Py_INCREF( PyExc_StopIteration );
+template_genfunc_yielder_body_template_stackless = """
+struct %(function_identifier)s_locals {
+%(function_heap_decls)s
+};
+
+static void %(function_identifier)s_context( Nuitka_GeneratorObject *generator )
+{
+    CHECK_OBJECT( (PyObject *)generator );
+    assert( Nuitka_Generator_Check( (PyObject *)generator ) );
+
+    // Heap access, the storage is allocated when the generator starts.
+    if ( generator->m_heap_storage == NULL )
+    {
+        generator->m_heap_storage = malloc( sizeof( struct %(function_identifier)s_locals ) );
+
+        // Finished with an exception then, like the error exit does.
+        if (unlikely( generator->m_heap_storage == NULL ))
+        {
+            PyErr_NoMemory();
+
+            generator->m_yielded = NULL;
+            return;
+        }
+    }
+
+    struct %(function_identifier)s_locals *generator_heap = (struct %(function_identifier)s_locals *)generator->m_heap_storage;
+
+    // Local variable declarations, these live in the heap storage.
+%(function_var_decls)s
+
+%(yield_dispatch)s
+    // Local variable initialization
+%(function_var_inits)s
 
+    // Actual function code.
+%(function_body)s
+
+%(generator_exit)s
+}
+"""
+
+template_generator_yield_dispatch = """\
+    // Dispatch to the yield point to resume at, if any.
+    switch( generator->m_yield_return_index )
+    {
+%(yield_return_cases)s
+    }
+"""
+
+template_generator_exception_exit = """\
+    // Exhausted, the StopIteration is only raised for callers that need it.
     generator->m_yielded = NULL;
     return;
 
@@ -68,12 +115,16 @@ template_generator_return_exit = """\
     return;
 
     function_return_exit:
-#if PYTHON_VERSION < 330
-    RESTORE_ERROR_OCCURRED( PyExc_StopIteration, NULL, NULL );
-#else
-    RESTORE_ERROR_OCCURRED( PyExc_StopIteration, tmp_return_value, NULL );
+#if PYTHON_VERSION >= 330
+    if ( tmp_return_value != Py_None )
+    {
+        generator->m_returned = tmp_return_value;
+    }
+    else
+    {
+        Py_DECREF( tmp_return_value );
+    }
 #endif
-    Py_INCREF( PyExc_StopIteration );
     generator->m_yielded = NULL;
     return;
 """
@@ -107,6 +158,16 @@ template_generator_making_with_context = """\
 }
 """
 
+template_yield_batched = """\
+if ( YIELD_BATCH( generator, %(value_name)s ) )
+{
+    %(to_name)s = Py_None;
+}
+else
+{
+%(yield_codes)s
+}"""
+
 
 from . import TemplateDebugWrapper # isort:skip
 TemplateDebugWrapper.checkDebug(globals())
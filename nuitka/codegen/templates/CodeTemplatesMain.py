@@ -210,6 +210,7 @@ int main( int argc, char **argv )
 
 #if PYTHON_VERSION < 300
     _initSlotCompare();
+    _initMethodDescrType();
 #endif
 #if PYTHON_VERSION >= 270
     _initSlotIternext();
@@ -151,6 +151,7 @@ MOD_INIT_DECL( %(module_identifier)s )
 
 #if PYTHON_VERSION < 300
     _initSlotCompare();
+    _initMethodDescrType();
 #endif
 #if PYTHON_VERSION >= 270
     _initSlotIternext();
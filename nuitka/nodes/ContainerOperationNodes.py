@@ -164,6 +164,10 @@ class StatementSetOperationAdd(StatementChildrenHavingBase):
 
         constraint_collection.removeKnowledge(self.getSet())
 
+        # Hashing the value may raise.
+        if not self.getValue().isKnownToBeHashable():
+            constraint_collection.onExceptionRaiseExit(BaseException)
+
         return self, None, None
 
 
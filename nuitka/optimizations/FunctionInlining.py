@@ -19,13 +19,35 @@
 
 Done by assigning the argument values to variables, and producing an outline
 from the in-lined function.
+
+Generator expressions that are immediately consumed, e.g. by "sum", can be
+in-lined too. Their body becomes a loop in an outline, where each "yield" is
+replaced with the statements of the consumer.
 """
 
-from nuitka.nodes.AssignNodes import StatementAssignmentVariable
-from nuitka.nodes.NodeMakingHelpers import makeVariableTargetRefNode
+from nuitka.nodes.AssignNodes import (
+    ExpressionTargetTempVariableRef,
+    ExpressionTempVariableRef,
+    StatementAssignmentVariable,
+    StatementReleaseVariable
+)
+from nuitka.nodes.ConditionalNodes import StatementConditional
+from nuitka.nodes.ConstantRefNodes import ExpressionConstantRef
+from nuitka.nodes.NodeMakingHelpers import (
+    makeVariableTargetRefNode,
+    mergeStatements
+)
 from nuitka.nodes.OutlineNodes import ExpressionOutlineBody
-from nuitka.tree.Extractions import updateVariableUsage
-from nuitka.tree.Helpers import makeStatementsSequence
+from nuitka.tree.Extractions import getNodesMatching, updateVariableUsage
+from nuitka.tree.Helpers import (
+    makeReraiseExceptionStatement,
+    makeStatementsSequence,
+    makeStatementsSequenceFromStatement
+)
+from nuitka.tree.ReformulationTryExceptStatements import \
+    makeTryExceptSingleHandlerNode
+from nuitka.tree.ReformulationTryFinallyStatements import \
+    makeTryFinallyStatement
 
 
 def convertFunctionCallToOutline(provider, function_ref, values):
@@ -93,3 +115,320 @@ def convertFunctionCallToOutline(provider, function_ref, values):
     outline_body.setBody(body)
 
     return outline_body
+
+
+def getGeneratorExpressionBody(node):
+    """ Get the generator expression body created by a function call.
+
+        Generator expressions are built as a function call with the iterator
+        as argument, that returns the generator object. Returns "None" if the
+        node is something else.
+    """
+
+    if not node.isExpressionFunctionCall():
+        return None
+
+    function_body = node.getFunction().getFunctionRef().getFunctionBody()
+
+    if not function_body.isExpressionFunctionBody():
+        return None
+
+    makers = getNodesMatching(
+        function_body.getBody(),
+        lambda node: node.isExpressionMakeGeneratorObject()
+    )
+
+    if len(makers) != 1:
+        return None
+
+    generator_body = makers[0].getGeneratorRef().getFunctionBody()
+
+    if generator_body.getFunctionName() != "<genexpr>":
+        return None
+
+    return generator_body
+
+
+def _replaceWithStatements(statement, statements):
+    parent = statement.parent
+
+    old_statements = list(parent.getStatements())
+    index = old_statements.index(statement)
+
+    parent.setStatements(
+        old_statements[ : index ]     + \
+        mergeStatements(statements)   + \
+        old_statements[ index+1 : ]
+    )
+
+
+def _translateToTempVariables(body, translation):
+    # Variable references of the user variables cannot point to temporary
+    # variables, these get replaced with temporary variable references.
+    def isUserVariableRef(node):
+        return node.isExpressionVariableRef() or \
+               node.isExpressionTargetVariableRef()
+
+    for node in getNodesMatching(body, isUserVariableRef):
+        new_variable = translation.get(node.getVariable())
+
+        if new_variable is None:
+            pass
+        elif node.isExpressionVariableRef():
+            node.replaceWith(
+                ExpressionTempVariableRef(
+                    variable   = new_variable,
+                    source_ref = node.getSourceReference()
+                )
+            )
+        else:
+            node.replaceWith(
+                ExpressionTargetTempVariableRef(
+                    variable   = new_variable,
+                    source_ref = node.getSourceReference()
+                )
+            )
+
+    for old_variable, new_variable in translation.items():
+        updateVariableUsage(
+            body,
+            old_variable = old_variable,
+            new_variable = new_variable
+        )
+
+
+_non_inlinable_kinds = (
+    "EXPRESSION_FUNCTION_REF",
+    "EXPRESSION_BUILTIN_LOCALS",
+    "EXPRESSION_BUILTIN_EVAL",
+    "EXPRESSION_BUILTIN_EXEC",
+    "EXPRESSION_BUILTIN_EXECFILE",
+    "STATEMENT_EXEC"
+)
+
+def convertGeneratorExpressionToOutline(provider, function_call, name,
+                                        makeConsumer, source_ref):
+    """ Convert a consumed generator expression to an outline.
+
+        The "makeConsumer" is called with the outline body and returns the
+        statements that initialize the consumer, a function giving the
+        statements to consume one value, a function giving the statements
+        that return the result, and the temporary variables to release.
+
+        Returns "None" if the generator expression cannot be in-lined.
+    """
+    # This has got to have pretty man details, pylint: disable=R0914
+
+    generator_body = getGeneratorExpressionBody(function_call)
+
+    if generator_body is None:
+        return None
+
+    if generator_body.isUnoptimized() or generator_body.hasLocalsDict():
+        return None
+
+    # With "generator_stop", a "StopIteration" leaking from the body becomes
+    # a "RuntimeError", which we do not do here.
+    if source_ref.getFutureSpec().isGeneratorStop():
+        return None
+
+    body = generator_body.getBody()
+
+    # Functions created inside would have to be moved to the new provider, and
+    # locals would be the ones of the provider.
+    if getNodesMatching(body, lambda node: node.kind in _non_inlinable_kinds):
+        return None
+
+    # The values must not be used, which is the case for generator expressions,
+    # but lets be sure.
+    for yield_node in getNodesMatching(body, lambda node: node.isExpressionYield()):
+        if not yield_node.parent.isStatementExpressionOnly():
+            return None
+
+    # Closure variables are used as they are, only owned ones get replaced.
+    variables = [
+        variable
+        for variable in
+        generator_body.getVariables()
+        if variable.getOwner() is generator_body
+    ]
+    variables += generator_body.getTempVariables()
+
+    for variable in variables:
+        if variable.isSharedTechnically():
+            return None
+
+    function_body = function_call.getFunction().getFunctionRef().getFunctionBody()
+
+    # The iterator parameter is shared with the generator body, but that goes
+    # away with both of them.
+    parameter_variables = function_body.getParameters().getAllVariables()
+    assert len(parameter_variables) == 1, parameter_variables
+
+    outline_body = ExpressionOutlineBody(
+        provider   = provider,
+        name       = name,
+        source_ref = source_ref
+    )
+
+    clone = body.makeClone()
+
+    temp_scope = outline_body.getOutlineTempScope()
+
+    translation = {}
+    release_variables = []
+
+    # Prefixed names, so the consumer can have its own temporary variables.
+    new_names = ["iterator"] + [
+        "var_" + variable.getName()
+        for variable in
+        variables
+    ]
+
+    for variable, new_name in zip(parameter_variables + variables, new_names):
+        new_variable = outline_body.allocateTempVariable(
+            temp_scope = temp_scope,
+            name       = new_name
+        )
+
+        translation[variable] = new_variable
+        release_variables.append(new_variable)
+
+    _translateToTempVariables(clone, translation)
+
+    yields = getNodesMatching(
+        clone,
+        lambda node: node.isExpressionYield()
+    )
+
+    init_statements, makeConsumeStatements, makeResultStatements, \
+      consumer_variables = makeConsumer(outline_body)
+
+    # The consumer runs inside the handler of "StopIteration" below, but it is
+    # not part of the generator expression, and what it raises must not end
+    # the iteration. So the value is computed first, and the consumer marks
+    # that it runs.
+    value_variable = outline_body.allocateTempVariable(
+        temp_scope = temp_scope,
+        name       = "value"
+    )
+    consuming_variable = outline_body.allocateTempVariable(
+        temp_scope = temp_scope,
+        name       = "consuming"
+    )
+    release_variables += [value_variable, consuming_variable]
+
+    def makeConsumingAssignment(value):
+        return StatementAssignmentVariable(
+            variable_ref = ExpressionTargetTempVariableRef(
+                variable   = consuming_variable,
+                source_ref = source_ref
+            ),
+            source       = ExpressionConstantRef(
+                constant   = value,
+                source_ref = source_ref
+            ),
+            source_ref   = source_ref
+        )
+
+    for yield_node in yields:
+        _replaceWithStatements(
+            statement  = yield_node.parent,
+            statements = (
+                StatementAssignmentVariable(
+                    variable_ref = ExpressionTargetTempVariableRef(
+                        variable   = value_variable,
+                        source_ref = source_ref
+                    ),
+                    source       = yield_node.getExpression(),
+                    source_ref   = source_ref
+                ),
+                makeConsumingAssignment(True)
+            ) + tuple(
+                makeConsumeStatements(
+                    ExpressionTempVariableRef(
+                        variable   = value_variable,
+                        source_ref = source_ref
+                    )
+                )
+            ) + (
+                makeConsumingAssignment(False),
+            )
+        )
+
+    # The frame of the generator is not needed, we are in the one of the
+    # provider now.
+    for frame in getNodesMatching(clone, lambda node: node.isStatementsFrame()):
+        _replaceWithStatements(
+            statement  = frame,
+            statements = frame.getStatements()
+        )
+
+    for entry in getNodesMatching(clone,
+                                  lambda node: node.isStatementGeneratorEntry()):
+        entry.parent.removeStatement(entry)
+
+    # A "StopIteration" raised by the body ends a generator expression, and
+    # the consumer just sees it exhausted. Raised by the consumer, it is
+    # passed on.
+    loop = makeTryExceptSingleHandlerNode(
+        tried          = clone,
+        exception_name = "StopIteration",
+        handler_body   = StatementConditional(
+            condition  = ExpressionTempVariableRef(
+                variable   = consuming_variable,
+                source_ref = source_ref
+            ),
+            yes_branch = makeReraiseExceptionStatement(
+                source_ref = source_ref
+            ),
+            no_branch  = makeStatementsSequence(
+                statements = makeResultStatements(),
+                allow_none = False,
+                source_ref = source_ref
+            ),
+            source_ref = source_ref
+        ),
+        source_ref     = source_ref
+    )
+
+    tried = makeStatementsSequence(
+        statements = (
+            StatementAssignmentVariable(
+                variable_ref = makeVariableTargetRefNode(
+                    variable   = release_variables[0],
+                    source_ref = source_ref
+                ),
+                source       = function_call.getArgumentValues()[0],
+                source_ref   = source_ref,
+            ),
+            init_statements,
+            makeConsumingAssignment(False),
+            loop,
+            makeResultStatements()
+        ),
+        allow_none = False,
+        source_ref = source_ref
+    )
+
+    final = [
+        StatementReleaseVariable(
+            variable   = variable,
+            source_ref = source_ref
+        )
+        for variable in
+        release_variables + list(consumer_variables)
+    ]
+
+    outline_body.setBody(
+        makeStatementsSequenceFromStatement(
+            statement = makeTryFinallyStatement(
+                provider   = outline_body,
+                tried      = tried,
+                final      = final,
+                source_ref = source_ref
+            )
+        )
+    )
+
+    return outline_body
@@ -65,6 +65,7 @@ from nuitka.nodes.BuiltinRangeNodes import (
 )
 from nuitka.nodes.BuiltinRefNodes import (
     ExpressionBuiltinAnonymousRef,
+    ExpressionBuiltinExceptionRef,
     ExpressionBuiltinOriginalRef,
     ExpressionBuiltinRef
 )
@@ -91,6 +92,14 @@ from nuitka.nodes.ConditionalNodes import (
     StatementConditional
 )
 from nuitka.nodes.ConstantRefNodes import ExpressionConstantRef
+from nuitka.nodes.ContainerMakingNodes import (
+    ExpressionMakeList,
+    ExpressionMakeSet
+)
+from nuitka.nodes.ContainerOperationNodes import (
+    StatementListOperationAppend,
+    StatementSetOperationAdd
+)
 from nuitka.nodes.ExecEvalNodes import (
     ExpressionBuiltinCompile,
     ExpressionBuiltinEval
@@ -100,13 +109,16 @@ from nuitka.nodes.GlobalsLocalsNodes import (
     ExpressionBuiltinGlobals,
     ExpressionBuiltinLocals
 )
+from nuitka.nodes.ExceptionNodes import StatementRaiseException
 from nuitka.nodes.ImportNodes import ExpressionBuiltinImport
 from nuitka.nodes.NodeMakingHelpers import (
+    makeComparisonNode,
     makeRaiseExceptionReplacementExpression,
     makeRaiseExceptionReplacementExpressionFromInstance,
     wrapExpressionWithSideEffects
 )
 from nuitka.nodes.OperatorNodes import (
+    ExpressionOperationBinary,
     ExpressionOperationNOT,
     ExpressionOperationUnary
 )
@@ -120,7 +132,7 @@ from nuitka.nodes.TypeNodes import (
     ExpressionBuiltinType1
 )
 from nuitka.nodes.VariableRefNodes import ExpressionVariableRef
-from nuitka.Options import isDebug, shallMakeModule
+from nuitka.Options import isDebug, isFullCompat, shallMakeModule
 from nuitka.PythonVersions import python_version
 from nuitka.tree.Helpers import (
     makeStatementsSequence,
@@ -132,6 +144,347 @@ from nuitka.tree.ReformulationTryFinallyStatements import \
 from nuitka.VariableRegistry import addVariableUsage
 
 from . import BuiltinOptimization
+from .FunctionInlining import convertGeneratorExpressionToOutline
+
+
+def _makeTempAssignment(variable, source, source_ref):
+    return StatementAssignmentVariable(
+        variable_ref = ExpressionTargetTempVariableRef(
+            variable   = variable,
+            source_ref = source_ref
+        ),
+        source       = source,
+        source_ref   = source_ref
+    )
+
+
+def _makeReturnConstant(constant, source_ref):
+    return StatementReturn(
+        expression = ExpressionConstantRef(
+            constant   = constant,
+            source_ref = source_ref
+        ),
+        source_ref = source_ref
+    )
+
+
+def extractGeneratorExpressionConsumer(node, name, makeConsumer):
+    """ In-line a generator expression given as the only argument to node.
+
+        The "makeConsumer" is called with the outline body and the source
+        reference, see "convertGeneratorExpressionToOutline" for what it has
+        to return. Returns "None" if that is not possible.
+    """
+
+    # The generator expression frame is not there anymore, which is visible
+    # in tracebacks.
+    if isFullCompat():
+        return None
+
+    if node.getCallKw() is not None:
+        return None
+
+    args = node.getCallArgs()
+
+    if args is None or not args.canPredictIterationValues():
+        return None
+
+    positional = args.getIterationValues()
+
+    if len(positional) != 1:
+        return None
+
+    source_ref = node.getSourceReference()
+
+    return convertGeneratorExpressionToOutline(
+        provider      = node.getParentVariableProvider(),
+        function_call = positional[0],
+        name          = name,
+        makeConsumer  = lambda outline_body: makeConsumer(
+            outline_body,
+            source_ref
+        ),
+        source_ref    = source_ref
+    )
+
+
+def _makeSumConsumer(outline_body, source_ref):
+    result_variable = outline_body.allocateTempVariable(
+        temp_scope = None,
+        name       = "sum_value"
+    )
+
+    def makeConsumeStatements(value):
+        return (
+            _makeTempAssignment(
+                variable   = result_variable,
+                source     = ExpressionOperationBinary(
+                    operator   = "Add",
+                    left       = ExpressionTempVariableRef(
+                        variable   = result_variable,
+                        source_ref = source_ref
+                    ),
+                    right      = value,
+                    source_ref = source_ref
+                ),
+                source_ref = source_ref
+            ),
+        )
+
+    def makeResultStatements():
+        return (
+            StatementReturn(
+                expression = ExpressionTempVariableRef(
+                    variable   = result_variable,
+                    source_ref = source_ref
+                ),
+                source_ref = source_ref
+            ),
+        )
+
+    init_statements = (
+        _makeTempAssignment(
+            variable   = result_variable,
+            source     = ExpressionConstantRef(
+                constant   = 0,
+                source_ref = source_ref
+            ),
+            source_ref = source_ref
+        ),
+    )
+
+    return (
+        init_statements,
+        makeConsumeStatements,
+        makeResultStatements,
+        (result_variable,)
+    )
+
+
+def _makeTruthConsumer(stop_value):
+    # Shared by "any" and "all", which stop at the first value that is true,
+    # or false respectively, and return "stop_value" then.
+
+    def makeConsumer(outline_body, source_ref):
+        # Nothing to allocate, pylint: disable=W0613
+
+        def makeConsumeStatements(value):
+            if not stop_value:
+                value = ExpressionOperationNOT(
+                    operand    = value,
+                    source_ref = source_ref
+                )
+
+            return (
+                StatementConditional(
+                    condition  = value,
+                    yes_branch = makeStatementsSequenceFromStatement(
+                        statement = _makeReturnConstant(
+                            constant   = stop_value,
+                            source_ref = source_ref
+                        )
+                    ),
+                    no_branch  = None,
+                    source_ref = source_ref
+                ),
+            )
+
+        def makeResultStatements():
+            return (
+                _makeReturnConstant(
+                    constant   = not stop_value,
+                    source_ref = source_ref
+                ),
+            )
+
+        return (), makeConsumeStatements, makeResultStatements, ()
+
+    return makeConsumer
+
+
+def _makeMinMaxConsumer(builtin_name, comparator):
+    def makeConsumer(outline_body, source_ref):
+        result_variable = outline_body.allocateTempVariable(
+            temp_scope = None,
+            name       = builtin_name + "_value"
+        )
+        empty_variable = outline_body.allocateTempVariable(
+            temp_scope = None,
+            name       = builtin_name + "_empty"
+        )
+        item_variable = outline_body.allocateTempVariable(
+            temp_scope = None,
+            name       = builtin_name + "_item"
+        )
+
+        def makeTempRef(variable):
+            return ExpressionTempVariableRef(
+                variable   = variable,
+                source_ref = source_ref
+            )
+
+        def makeConsumeStatements(value):
+            # Like CPython, the first value is kept on ties.
+            return (
+                _makeTempAssignment(
+                    variable   = item_variable,
+                    source     = value,
+                    source_ref = source_ref
+                ),
+                StatementConditional(
+                    condition  = makeTempRef(empty_variable),
+                    yes_branch = makeStatementsSequence(
+                        statements = (
+                            _makeTempAssignment(
+                                variable   = empty_variable,
+                                source     = ExpressionConstantRef(
+                                    constant   = False,
+                                    source_ref = source_ref
+                                ),
+                                source_ref = source_ref
+                            ),
+                            _makeTempAssignment(
+                                variable   = result_variable,
+                                source     = makeTempRef(item_variable),
+                                source_ref = source_ref
+                            )
+                        ),
+                        allow_none = False,
+                        source_ref = source_ref
+                    ),
+                    no_branch  = makeStatementsSequenceFromStatement(
+                        statement = StatementConditional(
+                            condition  = makeComparisonNode(
+                                left       = makeTempRef(item_variable),
+                                right      = makeTempRef(result_variable),
+                                comparator = comparator,
+                                source_ref = source_ref
+                            ),
+                            yes_branch = makeStatementsSequenceFromStatement(
+                                statement = _makeTempAssignment(
+                                    variable   = result_variable,
+                                    source     = makeTempRef(item_variable),
+                                    source_ref = source_ref
+                                )
+                            ),
+                            no_branch  = None,
+                            source_ref = source_ref
+                        )
+                    ),
+                    source_ref = source_ref
+                )
+            )
+
+        def makeResultStatements():
+            return (
+                StatementConditional(
+                    condition  = makeTempRef(empty_variable),
+                    yes_branch = makeStatementsSequenceFromStatement(
+                        statement = StatementRaiseException(
+                            exception_type  = ExpressionBuiltinExceptionRef(
+                                exception_name = "ValueError",
+                                source_ref     = source_ref
+                            ),
+                            exception_value = ExpressionConstantRef(
+                                constant   = "%s() arg is an empty sequence" % (
+                                    builtin_name
+                                ),
+                                source_ref = source_ref
+                            ),
+                            exception_trace = None,
+                            exception_cause = None,
+                            source_ref      = source_ref
+                        )
+                    ),
+                    no_branch  = None,
+                    source_ref = source_ref
+                ),
+                StatementReturn(
+                    expression = makeTempRef(result_variable),
+                    source_ref = source_ref
+                )
+            )
+
+        init_statements = (
+            _makeTempAssignment(
+                variable   = empty_variable,
+                source     = ExpressionConstantRef(
+                    constant   = True,
+                    source_ref = source_ref
+                ),
+                source_ref = source_ref
+            ),
+        )
+
+        return (
+            init_statements,
+            makeConsumeStatements,
+            makeResultStatements,
+            (result_variable, empty_variable, item_variable)
+        )
+
+    return makeConsumer
+
+
+def _makeContainerConsumer(container_class, operation_class, wrap_class):
+    # Shared by "list", "set" and "tuple", the later is a list at first.
+
+    def makeConsumer(outline_body, source_ref):
+        result_variable = outline_body.allocateTempVariable(
+            temp_scope = None,
+            name       = "container_value"
+        )
+
+        def makeConsumeStatements(value):
+            return (
+                operation_class(
+                    ExpressionTempVariableRef(
+                        variable   = result_variable,
+                        source_ref = source_ref
+                    ),
+                    value,
+                    source_ref
+                ),
+            )
+
+        def makeResultStatements():
+            result = ExpressionTempVariableRef(
+                variable   = result_variable,
+                source_ref = source_ref
+            )
+
+            if wrap_class is not None:
+                result = wrap_class(
+                    value      = result,
+                    source_ref = source_ref
+                )
+
+            return (
+                StatementReturn(
+                    expression = result,
+                    source_ref = source_ref
+                ),
+            )
+
+        init_statements = (
+            _makeTempAssignment(
+                variable   = result_variable,
+                source     = container_class(
+                    elements   = (),
+                    source_ref = source_ref
+                ),
+                source_ref = source_ref
+            ),
+        )
+
+        return (
+            init_statements,
+            makeConsumeStatements,
+            makeResultStatements,
+            (result_variable,)
+        )
+
+    return makeConsumer
 
 
 def dir_extractor(node):
@@ -411,6 +764,19 @@ def len_extractor(node):
     )
 
 def tuple_extractor(node):
+    result = extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "tuple_genexpr",
+        makeConsumer = _makeContainerConsumer(
+            container_class = ExpressionMakeList,
+            operation_class = StatementListOperationAppend,
+            wrap_class      = ExpressionBuiltinTuple
+        )
+    )
+
+    if result is not None:
+        return result
+
     return BuiltinOptimization.extractBuiltinArgs(
         node          = node,
         builtin_class = ExpressionBuiltinTuple,
@@ -418,6 +784,19 @@ def tuple_extractor(node):
     )
 
 def list_extractor(node):
+    result = extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "list_genexpr",
+        makeConsumer = _makeContainerConsumer(
+            container_class = ExpressionMakeList,
+            operation_class = StatementListOperationAppend,
+            wrap_class      = None
+        )
+    )
+
+    if result is not None:
+        return result
+
     return BuiltinOptimization.extractBuiltinArgs(
         node          = node,
         builtin_class = ExpressionBuiltinList,
@@ -425,6 +804,19 @@ def list_extractor(node):
     )
 
 def set_extractor(node):
+    result = extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "set_genexpr",
+        makeConsumer = _makeContainerConsumer(
+            container_class = ExpressionMakeSet,
+            operation_class = StatementSetOperationAdd,
+            wrap_class      = None
+        )
+    )
+
+    if result is not None:
+        return result
+
     return BuiltinOptimization.extractBuiltinArgs(
         node          = node,
         builtin_class = ExpressionBuiltinSet,
@@ -993,6 +1385,41 @@ def hash_extractor(node):
         builtin_spec  = BuiltinOptimization.builtin_hash_spec
     )
 
+def sum_extractor(node):
+    return extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "sum_genexpr",
+        makeConsumer = _makeSumConsumer
+    )
+
+def any_extractor(node):
+    return extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "any_genexpr",
+        makeConsumer = _makeTruthConsumer(True)
+    )
+
+def all_extractor(node):
+    return extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "all_genexpr",
+        makeConsumer = _makeTruthConsumer(False)
+    )
+
+def min_extractor(node):
+    return extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "min_genexpr",
+        makeConsumer = _makeMinMaxConsumer("min", "Lt")
+    )
+
+def max_extractor(node):
+    return extractGeneratorExpressionConsumer(
+        node         = node,
+        name         = "max_genexpr",
+        makeConsumer = _makeMinMaxConsumer("max", "Gt")
+    )
+
 
 _dispatch_dict = {
     "compile"    : compile_extractor,
@@ -1031,7 +1458,12 @@ _dispatch_dict = {
     # TODO: Disabled for now, not handling all cases.
     # "bytearray"  : bytearray_extractor,
     "slice"      : slice_extractor,
-    "hash"       : hash_extractor
+    "hash"       : hash_extractor,
+    "sum"        : sum_extractor,
+    "any"        : any_extractor,
+    "all"        : all_extractor,
+    "min"        : min_extractor,
+    "max"        : max_extractor
 }
 
 if python_version < 300:
@@ -70,3 +70,26 @@ def updateVariableUsage(provider, old_variable, new_variable):
     )
 
     visitTree(provider, visitor)
+
+
+class NodeMatchExtractor(VisitorNoopMixin):
+    """ Extract nodes matching a predicate.
+
+    """
+    def __init__(self, predicate):
+        self.predicate = predicate
+        self.matches = []
+
+    def onEnterNode(self, node):
+        if self.predicate(node):
+            self.matches.append(node)
+
+    def getResult(self):
+        return self.matches
+
+
+def getNodesMatching(node, predicate):
+    visitor = NodeMatchExtractor(predicate)
+    visitTree(node, visitor)
+
+    return visitor.getResult()
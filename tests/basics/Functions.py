@@ -472,6 +472,25 @@ d = { "other" : 7, 'c' : 3 }
 
 print("Dual star args consuming function", posDoubleStarArgsFunction(1,  *l, **d))
 
+def starListIdentity():
+    def returnStarList(*args):
+        return args
+
+    def passStarListOn(*args, **kwargs):
+        return returnStarList(*args, **kwargs)
+
+    def compareStarList(*args):
+        return args is t
+
+    t = (1, 2)
+
+    print("Star list parameter is a new tuple", returnStarList(*t) is t)
+    print("Also through a wrapper", passStarListOn(*t) is t)
+    print("Also for the callee", compareStarList(*t))
+    print("But equal", passStarListOn(*t) == t)
+
+starListIdentity()
+
 import inspect, sys
 
 for value in sorted(dir()):
@@ -0,0 +1,105 @@
+#     Copyright 2016, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Generators consumed by loops, that must not run ahead of them.
+
+With "--generator-batch-size", generators may yield several values to loops
+before switching back, but only where that cannot be noticed.
+"""
+
+from __future__ import print_function
+
+import sys
+
+log = []
+
+def logging():
+    for i in range(5):
+        log.append(("generator", i))
+        yield i
+
+print("Side effects of generator and loop interleave:")
+for value in logging():
+    log.append(("loop", value))
+
+print(log)
+
+counter = 0
+
+def counting():
+    global counter
+
+    while True:
+        counter += 1
+        yield counter
+
+print("Loop leaving by exception, while state is changed:")
+try:
+    for value in counting():
+        if value == 3:
+            raise ValueError(value)
+except ValueError as e:
+    print("Raised", e, "with counter", counter)
+
+shared = [1]
+
+def reading():
+    yield shared[0]
+    yield shared[0]
+    yield shared[0]
+
+print("Values read after the loop changed them:")
+for value in reading():
+    print(value)
+    shared[0] += 1
+
+def exceptionInfo():
+    try:
+        raise KeyError
+    except KeyError:
+        yield sys.exc_info()[0]
+    yield sys.exc_info()[0]
+
+print("Exception state of the generator and the loop:")
+for value in exceptionInfo():
+    try:
+        raise TypeError
+    except TypeError:
+        print(value)
+
+def constants():
+    yield 1
+    yield "two"
+    yield (3, 4)
+
+def forever():
+    while True:
+        yield 1
+        yield 2
+
+print("Generators without side effects:")
+for value in constants():
+    print(value)
+
+count = 0
+for value in forever():
+    count += value
+
+    if count > 20:
+        break
+
+print("Count", count)
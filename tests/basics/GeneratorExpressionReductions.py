@@ -0,0 +1,95 @@
+#     Copyright 2016, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Generator expressions consumed by built-ins that reduce them.
+
+With "--improved", these get in-lined, and must still behave the same.
+"""
+
+from __future__ import print_function
+
+def check(name, func):
+    try:
+        result = func()
+    except StopIteration:
+        print(name, "raised StopIteration")
+    except Exception as e:
+        print(name, "raised", repr(e))
+    else:
+        print(name, "gave", result)
+
+values = [3, 1, 4, 1, 5, 9, 2, 6]
+
+print("Normal results:")
+check("sum", lambda : sum(x * 2 for x in values))
+check("sum empty", lambda : sum(x for x in ()))
+check("any", lambda : any(x > 4 for x in values))
+check("any none", lambda : any(x > 10 for x in values))
+check("all", lambda : all(x > 0 for x in values))
+check("all not", lambda : all(x > 1 for x in values))
+check("min", lambda : min(x for x in values if x > 1))
+check("max", lambda : max(-x for x in values))
+check("min empty", lambda : min(x for x in ()))
+check("list", lambda : list(x for x in values if x % 2))
+check("tuple", lambda : tuple(x + y for x in (1, 2) for y in (10, 20)))
+check("set", lambda : sorted(set(x for x in values)))
+
+def stopAt(x):
+    if x == 5:
+        raise StopIteration
+
+    return x
+
+print("StopIteration from the generator expression body ends it:")
+check("sum", lambda : sum(stopAt(x) for x in values))
+check("any", lambda : any(stopAt(x) > 4 for x in values))
+check("all", lambda : all(stopAt(x) > 0 for x in values))
+check("min", lambda : min(stopAt(x) for x in values))
+check("max", lambda : max(stopAt(x) for x in values))
+check("list", lambda : list(stopAt(x) for x in values))
+
+class StopInConsumer(object):
+    def __init__(self, value):
+        self.value = value
+
+    def __add__(self, other):
+        raise StopIteration
+
+    __radd__ = __add__
+
+    def __nonzero__(self):
+        raise StopIteration
+
+    __bool__ = __nonzero__
+
+    def __lt__(self, other):
+        raise StopIteration
+
+    __gt__ = __lt__
+
+    def __hash__(self):
+        raise StopIteration
+
+stoppers = [StopInConsumer(1), StopInConsumer(2)]
+
+print("StopIteration from the consumer is not the end:")
+check("sum", lambda : sum(x for x in stoppers))
+check("any", lambda : any(x for x in stoppers))
+check("all", lambda : all(x for x in stoppers))
+check("min", lambda : min(x for x in stoppers))
+check("max", lambda : max(x for x in stoppers))
+check("set", lambda : set(x for x in stoppers))
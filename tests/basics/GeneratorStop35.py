@@ -0,0 +1,87 @@
+#     Copyright 2016, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Generators with "generator_stop", where StopIteration is not the end.
+
+"""
+
+from __future__ import generator_stop
+
+def exhausting():
+    yield 1
+    yield 2
+
+def returning():
+    yield 1
+    return 2
+
+def stopping():
+    yield 1
+    raise StopIteration
+
+def stoppingInNext():
+    yield 1
+    next(iter(()))
+
+def delegating(gen):
+    result = yield from gen()
+    yield result
+
+def check(name, func):
+    try:
+        result = func()
+    except StopIteration as e:
+        print(name, "raised StopIteration", e.args)
+    except RuntimeError as e:
+        print(name, "raised RuntimeError", e, type(e.__cause__))
+    except Exception as e:
+        print(name, "raised", repr(e))
+    else:
+        print(name, "gave", result)
+
+def looping(gen):
+    result = []
+
+    for value in gen():
+        result.append(value)
+
+    return result
+
+def unpacking(gen):
+    a, b = gen()
+
+    return a, b
+
+def nexting(gen):
+    it = gen()
+
+    return next(it), next(it, "default")
+
+def sending(gen):
+    it = gen()
+
+    return it.send(None), it.send(None)
+
+for gen in (exhausting, returning, stopping, stoppingInNext):
+    print("Generator", gen.__name__)
+
+    check("list", lambda : list(gen()))
+    check("loop", lambda : looping(gen))
+    check("unpacking", lambda : unpacking(gen))
+    check("next", lambda : nexting(gen))
+    check("send", lambda : sending(gen))
+    check("yield from", lambda : list(delegating(gen)))
@@ -0,0 +1,132 @@
+#     Copyright 2016, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Frames of functions left by exceptions, as kept by their tracebacks.
+
+"""
+
+from __future__ import print_function
+
+import gc
+import sys
+import weakref
+
+
+def describeTraceback(tb):
+    result = []
+
+    while tb is not None:
+        frame = tb.tb_frame
+
+        result.append(
+            (
+                frame.f_code.co_name,
+                tb.tb_lineno,
+                sorted(
+                    (key, value)
+                    for key, value in frame.f_locals.items()
+                    if type(value) is int
+                )
+            )
+        )
+
+        tb = tb.tb_next
+
+    return result
+
+def raising(value):
+    doubled = value * 2
+    raise ValueError(doubled)
+
+def catching(value):
+    try:
+        raising(value)
+    except ValueError:
+        return sys.exc_info()[2]
+
+print("Tracebacks keep the frames with their values:")
+
+tracebacks = [catching(value) for value in range(3)]
+
+# Using the function again, must not change the frames kept.
+for value in range(10, 20):
+    catching(value)
+
+# Only the frames left by the exception, the catching one has no locals for
+# Nuitka.
+for tb in tracebacks:
+    print(tb.tb_frame.f_code.co_name, describeTraceback(tb.tb_next))
+
+del tracebacks
+
+def recursing(depth, collected):
+    try:
+        if depth == 0:
+            raise KeyError(depth)
+
+        recursing(depth - 1, collected)
+    except KeyError:
+        collected.append(sys.exc_info()[2])
+
+        raise KeyError(depth)
+
+print("Recursing deeper than cached frames, raising at every level:")
+
+for attempt in range(2):
+    collected = []
+
+    try:
+        recursing(20, collected)
+    except KeyError as e:
+        print("Attempt", attempt, "gave", repr(e))
+
+    for tb in collected[::5]:
+        print(describeTraceback(tb)[-2:])
+
+    del collected
+
+class Marker:
+    pass
+
+def makeCycle():
+    marker = Marker()
+    info = None
+
+    try:
+        raising(1)
+    except ValueError:
+        info = sys.exc_info()
+
+    raise KeyError(marker)
+
+def checkCycle():
+    try:
+        makeCycle()
+    except KeyError as e:
+        marker_ref = weakref.ref(e.args[0])
+
+    return marker_ref
+
+print("Frames and tracebacks referencing each other are collected:")
+
+marker_ref = checkCycle()
+gc.collect()
+
+print("Marker released", marker_ref() is None)
+
+print("Frames are usable afterwards:")
+print(describeTraceback(catching(5).tb_next))
@@ -36,6 +36,7 @@ from test_common import (
     compareWithCPython,
     hasDebugPython,
     withPythonPathChange,
+    withExtendedExtraOptions,
     createSearchMode
 )
 
@@ -52,6 +53,31 @@ if python_version >= "3.4":
     )
 
 
+# These tests are run again with options, that change the code they cover.
+extra_option_runs = {
+    # Generator expressions are in-lined only if not fully compatible.
+    "GeneratorExpressionReductions.py" : (
+        "--improved",
+    ),
+    # Generators compiled to resumable functions instead of fibers.
+    "GeneratorExpressions.py" : (
+        "--stackless-generators",
+    ),
+    "ThreadedGenerators.py" : (
+        "--stackless-generators",
+    ),
+    "TryYieldFinally.py" : (
+        "--stackless-generators",
+    ),
+    "YieldFrom33.py" : (
+        "--stackless-generators",
+    ),
+    # Generators yielding ahead to loops.
+    "GeneratorBatching.py" : (
+        "--generator-batch-size=4",
+    ),
+}
+
 # Create large constants test on the fly, if it's not there, not going to
 # add it to release archives for no good reason.
 if not os.path.exists("BigConstants.py"):
@@ -127,6 +153,18 @@ for filename in sorted(os.listdir('.')):
                 search_mode = search_mode,
                 needs_2to3  = needs_2to3
             )
+
+            for extra_option in extra_option_runs.get(filename, ()):
+                my_print("Again with", extra_option)
+
+                with withExtendedExtraOptions(extra_option):
+                    compareWithCPython(
+                        dirname     = None,
+                        filename    = filename,
+                        extra_flags = extra_flags,
+                        search_mode = search_mode,
+                        needs_2to3  = needs_2to3
+                    )
     else:
         my_print("Skipping", filename)
 